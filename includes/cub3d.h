@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:52:52 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 23:57:30 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:03 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,17 +24,38 @@
 # include <stdio.h>
 # include <stdbool.h>
 # include <sys/time.h>
+# include <sys/stat.h>
+# include <dirent.h>
+# include <errno.h>
+# include <pthread.h>
+# include <limits.h>
 
 /* =========================== */
 /*         DEFINE              */
 /* =========================== */
 
 /* file validation errors */
-# define ARG_USAGE "Usage: ./cub3D <valid_map.cub>"
+# define ARG_USAGE "Usage: ./cub3D <map.cub> [--res WxH] [--palette] [--spans]"
+# define ARG_USAGE_OPTIONS " [--fog N] [--max-dist N] [--aa N] [--bilinear]"
+# define ARG_RES_FORMAT "Invalid resolution. Expected: WIDTHxHEIGHT"
+# define ARG_FOG_FORMAT "Invalid fog distance. Expected: a positive number"
+# define ARG_MAX_DIST_FORMAT "Invalid max distance. Expected: a positive number"
+# define ARG_USAGE_ISA " [--force-isa ISA] [--quiet|--verbose]"
+# define ARG_AA_FORMAT "Invalid AA samples. Expected: 2 to 4"
+# define ARG_ISA_FORMAT "Invalid ISA. Expected: scalar, sse2 or avx2"
+# define ISA_UNSUPPORTED "This CPU cannot run the render kernels: "
 # define FILENAME_NULL "Filename is NULL, please use a valid file"
 # define FILENAME_LENGHT "Filename is too short. Minimum required: x.cub"
 # define FILENAME_EXTENSION "Filename extension is invalid. Expected: .cub"
 # define FILENAME_HIDDEN "Filename can't be a hidden file"
+# define FILE_OPEN "open: "
+# define FILE_READ "read: "
+
+/* batch check errors */
+# define CHECK_USAGE "Usage: ./cub3D --check [--jobs N] <file.cub|dir>..."
+# define CHECK_JOBS_FORMAT "Invalid job count. Expected: 1 to 256"
+# define CHECK_DIR "Cannot read directory: "
+# define CHECK_ALLOC "Allocation of the check list failed"
 
 /* player parsing errors */
 # define PLAYER_ORIENTATION "Invalid player orientation"
@@ -42,13 +63,13 @@
 # define PLAYER_MULTI "Multiple players detected"
 
 /* map parsing errors */
-# define MAP_DIMENSIONS "Invalid map dimensions"
-# define MAP_TOO_LARGE "Map too large (max 100 x 100)"
+# define MAP_TOO_LARGE "Map too large (max 4096 x 4096)"
 # define MAP_CHAR "Invalid character in map"
 # define MAP_ZERO_BORDER "Map not closed: 0 on border"
 # define MAP_ZERO_INVALID "Map not closed: 0 adjacent to invalid cell"
 # define MAP_SPACE "Map not closed: space adjacent to walkable area"
 # define MAP_LOAD "Failed to load map grid"
+# define MAP_REACH "Allocation of the map reachability analysis failed"
 
 /* header parsing errors */
 # define HEADER_DUPLICATE "Duplicate header identifier"
@@ -62,7 +83,6 @@
 # define TEXTURE_EMPTY "Texture path missing or empty"
 
 /* RGB/color related errors */
-# define RGB_SPLIT_FAIL "RGB: split failed"
 # define RGB_INVALID_FORMAT "RGB: exactly 3 components ranged 0-255 required"
 # define RGB_TOO_MANY "RGB: Too many values. Expected: 3"
 
@@ -73,18 +93,26 @@
 # define IMG_INIT "Initialization of the MLX image buffer failed"
 # define IMG_DATA "Retrieving IMG data failed"
 # define TEXTURE_LOAD "Failed to load texture"
-# define TEXTURE_DIMENSION "Texture is not 64x64"
 # define TEXTURE_DATA "Failed to retrieved necessary textures data"
+# define TEXTURE_ATLAS "Failed to allocate texture atlas"
+# define SCALE_INIT "Allocation of the scaled render buffer failed"
 # define WIN_TOO_SMALL "Window size too small (minimum: 640x480)"
 # define WIN_TOO_LARGE "Window size exceeds screen dimensions"
 
 /* map and header constants */
 # define PLAYER "NSEW"
 # define TILE_CENTER_OFFSET 0.5
-# define MAX_MAP_W 100
-# define MAX_MAP_H 100
+# define MAX_MAP_W 4096
+# define MAX_MAP_H 4096
+# define REACH_MARK 'r'
+# define MAP_BAND_MIN_ROWS 256
+# define MAP_BAND_MAX 64
+# define ARENA_ALIGN 16
+# define ARENA_GROW_MIN 4096
+# define ROW_CHUNK_SIZE 16384
 # define RGB_SIZE 3
 # define TEX_SIZE 4
+# define XPM_EXTENSION ".xpm"
 
 /* table constants */
 # define ADJACENT_DIR_COUNT 4
@@ -95,13 +123,38 @@
 # define WINDOWS_MSG "Welcome to CUB3D"
 # define WINDOWS_X 1824
 # define WINDOWS_Y 925
+# define RES_FLAG "--res"
+# define PALETTE_FLAG "--palette"
+# define SPANS_FLAG "--spans"
+# define BILINEAR_FLAG "--bilinear"
+# define QUIET_FLAG "--quiet"
+# define VERBOSE_FLAG "--verbose"
+# define FOG_FLAG "--fog"
+# define MAX_DIST_FLAG "--max-dist"
+# define AA_FLAG "--aa"
+# define ISA_FLAG "--force-isa"
+# define CHECK_FLAG "--check"
+# define JOBS_FLAG "--jobs"
+# define CHECK_MAX_JOBS 256
+# define CHECK_EXTENSION ".cub"
+# define ERROR_LOG_SIZE 256
 # define MIN_SCREEN_WIDTH 640
 # define MIN_SCREEN_HEIGHT 480
 # define MAX_SCREEN_WIDTH 2560
 # define MAX_SCREEN_HEIGHT 1440
-# define TEXTURE_WIDTH 64
-# define TEXTURE_HEIGHT 64
+# define MIP_LEVELS 12
+# define ATLAS_ALIGN 64
+# define PALETTE_SIZE 256
+# define SHADE_LEVELS 32
+# define FOG_COLOR 0x000000
+# define SHADED_PALETTES_SIZE (SHADE_LEVELS * PALETTE_SIZE * 4)
+# define BILINEAR_ROWS 64
 # define MIN_WALL_DISTANCE 0.001
+# define NO_RAY_LIMIT 1e30
+# define AA_MAX_SAMPLES 4
+# define AA_DEPTH_RATIO 0.1
+# define AA_STATS_MSG "AA columns: "
+# define AA_STATS_COLOR 0xFFFFFF
 # define VERTICAL_WALL 0
 # define HORIZONTAL_WALL 1
 # define TEXTURE_FALLBACK_COLOR 0x000000
@@ -110,6 +163,21 @@
 # define MOUSE_SENSITIVITY 0.002
 # define US_PER_SECOND 1000000
 # define FRAME_TIME_US 16666
+# define FRAME_ALLOC_MSG "Frame %ld: %ld allocations, %ld frees\n"
+
+/* startup output (print_startup_info()) */
+# define VERBOSITY_QUIET 0
+# define VERBOSITY_NORMAL 1
+# define VERBOSITY_MAP 2
+
+/* dynamic resolution scaling (render size = window size * level / DEN) */
+# define RENDER_SCALE_DEN 8
+# define RENDER_SCALE_MIN 4
+# define RENDER_BUDGET_US 12500
+# define SCALE_RAISE_PCT 55
+# define SCALE_EMA_WEIGHT 8
+# define SCALE_DROP_FRAMES 10
+# define SCALE_RAISE_FRAMES 60
 
 /* =========================== */
 /*        STRUCTURES           */
@@ -128,19 +196,88 @@ typedef enum e_header_type
 	HEADER_SIZE = 6
 }	t_header_type;
 
+/* part of a string, used in place: len characters from s */
+typedef struct s_view
+{
+	const char	*s;
+	size_t		len;
+}	t_view;
+
+/* bump allocator: one block, carved in order and freed at once */
+typedef struct s_arena
+{
+	char	*base;
+	size_t	used;
+	size_t	cap;
+}	t_arena;
+
+/* map statistics, from the flood fill from the player spawn */
+typedef struct s_map_stats
+{
+	int	open_cells;
+	int	reachable;
+	int	components;
+	int	full_width;
+	int	full_height;
+	int	crop_x;
+	int	crop_y;
+}	t_map_stats;
+
+/* flood fill state: cells to visit and bounding box of the cells seen */
+typedef struct s_flood
+{
+	int	*stack;
+	int	len;
+	int	box[4];
+}	t_flood;
+
 /* map structure - stores parsed .cub file data */
 typedef struct s_map
 {
-	char	**grid;
-	int		width;
-	int		height;
-	int		floor_color[RGB_SIZE];
-	int		ceiling_color[RGB_SIZE];
-	char	*tex_paths[TEX_SIZE];
-	bool	id_set[HEADER_SIZE];
-	int		map_start_line;
+	char		**grid;
+	int			width;
+	int			height;
+	int			floor_color[RGB_SIZE];
+	int			ceiling_color[RGB_SIZE];
+	int			floor_rgb;
+	int			ceiling_rgb;
+	char		*tex_paths[HEADER_SIZE];
+	bool		id_set[HEADER_SIZE];
+	int			map_start_line;
+	t_map_stats	stats;
+	t_arena		strings;
 }	t_map;
 
+/* map rows read from a .cub file: the file goes through one chunk, the
+   rows into three buffers used in turn (the streaming window) */
+typedef struct s_row_reader
+{
+	int		fd;
+	int		pos;
+	int		len;
+	int		count;
+	bool	error;
+	char	*rows[3];
+	int		caps[3];
+	char	chunk[ROW_CHUNK_SIZE];
+}	t_row_reader;
+
+/* streaming map validator: last three rows read and the player found */
+typedef struct s_map_stream
+{
+	const char	*rows[3];
+	int			lens[3];
+	int			width;
+	int			height;
+	int			player_x;
+	int			player_y;
+	char		player_dir;
+	int			max_width;
+	int			max_height;
+	int			check_rows;
+	char		*too_large;
+}	t_map_stream;
+
 /* tracks which keys are currently pressed */
 typedef struct s_keys
 {
@@ -163,18 +300,130 @@ typedef struct s_player
 	double	plane_y;
 }	t_player;
 
-/* texture data loaded from .xpm files */
+/* wall span: frame pixels, texture column, 16.16 row, palette and shade */
+typedef struct s_span
+{
+	unsigned int			*dst;
+	int						dst_stride;
+	int						count;
+	int						tex_x;
+	int						tex_fx;
+	long					pos;
+	long					step;
+	const unsigned int		*palette;
+	const unsigned char		*shade;
+}	t_span;
+
+/* one mip level: 32-bit pixels or 8-bit palette indices, and its sampler */
+typedef struct s_mip
+{
+	unsigned int		*pixels;
+	unsigned char		*indices;
+	const unsigned int	*palette;
+	int					width;
+	int					height;
+	int					stride;
+	int					row_shift;
+	int					row_mask;
+	void				(*sample)(t_span span, const struct s_mip *mip);
+	void				(*sample_shaded)(t_span span, const struct s_mip *mip);
+}	t_mip;
+
+/* instruction sets the render kernels are built for */
+typedef enum e_isa
+{
+	ISA_SCALAR = 0,
+	ISA_SSE2 = 1,
+	ISA_AVX2 = 2,
+	ISA_COUNT = 3
+}	t_isa;
+
+/* render kernels of one instruction set, chosen once at startup */
+typedef struct s_kernels
+{
+	t_isa	isa;
+	void	(*fill_row)(unsigned int *dst, unsigned int color, int n);
+	void	(*copy_row)(unsigned int *dst, const unsigned int *src, int n);
+	void	(*upscale_row_2x)(unsigned int *dst, const unsigned int *src,
+			int src_w);
+	void	(*sample_wall_bilinear)(t_span span, const t_mip *mip);
+	void	(*sample_wall_nearest)(t_span span, const t_mip *mip);
+}	t_kernels;
+
+/* texture loaded from an .xpm file, mips point into the atlas */
 typedef struct s_texture
 {
-	void	*img;
-	char	*addr;
-	int		width;
-	int		height;
-	int		bpp;
-	int		line_len;
-	int		endian;
+	void			*img;
+	char			*addr;
+	int				width;
+	int				height;
+	int				bpp;
+	int				line_len;
+	int				endian;
+	t_mip			mips[MIP_LEVELS];
+	int				mip_count;
+	bool			palettise;
+	int				palette_size;
+	unsigned int	palette[PALETTE_SIZE];
+	unsigned int	*shaded_palettes;
 }	t_texture;
 
+/* single aligned block holding every texture level, size in bytes */
+typedef struct s_atlas
+{
+	unsigned char	*data;
+	void			*raw;
+	size_t			size;
+}	t_atlas;
+
+/* distance fog: per light level channel tables (r, g, b, 256 each) */
+typedef struct s_shade
+{
+	double			fog_dist;
+	double			level_scale;
+	unsigned char	lut[SHADE_LEVELS][3 * 256];
+}	t_shade;
+
+/* drawing info for the wall slice of one column */
+typedef struct s_draw_info
+{
+	int		x;
+	int		draw_start;
+	int		draw_end;
+	int		line_height;
+	int		wall_dir;
+	double	wall_x;
+	double	wall_dist;
+	bool	far;
+	int		map_x;
+	int		map_y;
+}	t_draw_info;
+
+/* render target the raycaster draws into (window image or scaled buffer) */
+typedef struct s_frame
+{
+	unsigned int	*pixels;
+	int				width;
+	int				height;
+	int				stride;
+	double			*camera_x;
+	t_draw_info		*columns;
+	long			dda_steps;
+	unsigned int	*aa_rows;
+	int				aa_columns;
+}	t_frame;
+
+/* dynamic resolution controller state and low resolution render buffer */
+typedef struct s_scaler
+{
+	unsigned int	*buffer;
+	int				*x_map;
+	int				level;
+	long			avg_us;
+	int				over_count;
+	int				under_count;
+}	t_scaler;
+
 /* encapsulates the entire game state and resources */
 typedef struct s_game
 {
@@ -185,7 +434,19 @@ typedef struct s_game
 	int			img_bpp;
 	int			img_line_len;
 	int			img_endian;
-	t_texture	textures[4];
+	int			win_w;
+	int			win_h;
+	bool		palette_mode;
+	bool		span_mode;
+	bool		bilinear;
+	int			verbosity;
+	double		max_ray_dist;
+	int			aa_samples;
+	t_texture	textures[HEADER_SIZE];
+	t_atlas		atlas;
+	t_shade		shade;
+	t_frame		frame;
+	t_scaler	scaler;
 	t_player	player;
 	t_map		map;
 	t_keys		keys;
@@ -233,6 +494,9 @@ typedef struct s_ray
 	int		step_x;
 	int		step_y;
 	int		side;
+	double	max_dist;
+	bool	far;
+	int		steps;
 }	t_ray;
 
 /* ray result structure containing all raycasting outputs */
@@ -241,29 +505,95 @@ typedef struct s_ray_result
 	double	wall_dist;
 	int		wall_dir;
 	double	wall_x;
+	bool	far;
+	int		steps;
+	int		map_x;
+	int		map_y;
 }	t_ray_result;
 
-/* column drawing parameters for rendering */
-typedef struct s_col
+/* floor/ceiling texture coordinates of one screen row, 0.32 fixed point */
+typedef struct s_floor_row
 {
-	int	x;
-	int	start;
-	int	end;
-	int	color;
-}	t_col;
+	unsigned int		u;
+	unsigned int		v;
+	unsigned int		step_u;
+	unsigned int		step_v;
+	const unsigned char	*shade;
+}	t_floor_row;
+
+/* error messages kept by print_errors() instead of printing them */
+typedef struct s_error_log
+{
+	char	msg[ERROR_LOG_SIZE];
+	size_t	len;
+}	t_error_log;
 
-/* drawing info for a complete column (ceiling + wall + floor) */
-typedef struct s_draw_info
+/* one file of a --check run and its outcome */
+typedef struct s_check_file
 {
-	int		x;
-	int		draw_start;
-	int		draw_end;
-	int		line_height;
-	int		ceiling;
-	int		floor;
-	int		wall_dir;
-	double	wall_x;
-}	t_draw_info;
+	char		*path;
+	bool		ok;
+	t_error_log	log;
+}	t_check_file;
+
+/* --check run: files to validate, shared by the worker threads */
+typedef struct s_check
+{
+	t_check_file	*files;
+	int				count;
+	int				capacity;
+	int				next;
+	int				jobs;
+	pthread_mutex_t	lock;
+}	t_check;
+
+/* banded check of rows [y0, y1) of a map, shared by its threads; with
+   lens set, rows are checked as the stream does (check_map_row()) */
+typedef struct s_band_check
+{
+	t_map			*map;
+	const int		*lens;
+	int				y0;
+	int				y1;
+	long			first_error;
+	pthread_mutex_t	lock;
+}	t_band_check;
+
+/* rows [y0, y1) of a map checked by one thread, and its first error */
+typedef struct s_band
+{
+	t_band_check	*shared;
+	int				y0;
+	int				y1;
+	long			error_at;
+	t_error_log		log;
+	pthread_t		thread;
+	bool			started;
+}	t_band;
+
+/* =========================== */
+/*           CHECK             */
+/* =========================== */
+
+/* check_mode.c */
+int						run_check(int argc, char **argv);
+
+/* check_paths.c */
+int						collect_check_paths(t_check *check, int argc,
+							char **argv);
+
+/* check_paths_utils.c */
+bool					is_directory(const char *path);
+bool					is_real_directory(const char *path);
+bool					has_cub_extension(const char *name);
+char					*join_path(const char *dir, const char *name);
+int						compare_check_paths(const void *a, const void *b);
+
+/* check_pool.c */
+void					run_check_pool(t_check *check);
+
+/* check_report.c */
+int						print_check_report(const t_check *check);
 
 /* =========================== */
 /*           EVENTS            */
@@ -274,6 +604,7 @@ int						handle_keypress(int keycode, void *param);
 int						handle_keyrelease(int keycode, void *param);
 int						handle_close(void *param);
 int						game_loop(void *param);
+void					run_frame(t_game *game);
 t_key_binding			*get_key_bindings(t_game *game);
 
 /* mouse_handler.c */
@@ -301,11 +632,40 @@ void					strafe_right(t_game *game);
 void					init_t_game(t_game *game);
 
 /* init_mlx_utils.c */
-int						validate_window_size(void *mlx);
+int						validate_window_size(void *mlx, int width, int height);
+
+/* parse_args.c */
+int						parse_args(int argc, char **argv, t_game *game);
+
+/* parse_args_utils.c */
+int						parse_resolution(const char *arg, t_game *game);
+int						parse_distance(const char *arg, double *out,
+							char *error);
+int						parse_samples(const char *arg, int *out);
+int						parse_isa(const char *arg);
 
 /* init_mlx.c */
 int						init_graphics(t_game *game);
 
+/* init_atlas.c */
+int						build_texture_atlas(t_atlas *atlas, t_texture *textures,
+							int count, const t_shade *shade);
+
+/* init_mipmaps.c */
+unsigned int			average_pixels(const unsigned int px[4]);
+void					layout_mip_levels(t_texture *tex);
+void					build_mipmaps(t_texture *tex);
+
+/* init_palette.c */
+unsigned char			nearest_palette_index(const t_texture *tex,
+							unsigned int color);
+bool					collect_palette(t_texture *tex);
+
+/* init_palette_levels.c */
+void					build_palette_levels(t_texture *tex);
+void					build_shaded_palettes(t_texture *tex,
+							const t_shade *shade);
+
 /* init_textures.c */
 int						init_textures(t_game *game);
 
@@ -314,7 +674,7 @@ int						init_textures(t_game *game);
 /* =========================== */
 
 /* check_headers.c */
-int						check_header_count(const char *path);
+int						check_header_count(const char *path, size_t *bytes);
 
 /* file_validations.c */
 int						validate_argument(char *filename);
@@ -323,11 +683,14 @@ int						validate_argument(char *filename);
 const t_header_entry	*get_header_entry(const char *line);
 
 /* header_utils.c */
-void					next_line(char **line, int fd, int *i);
+void					next_line(char **line, t_gnl *gnl, int *i);
 bool					line_is_empty(char *line);
+bool					value_is_xpm_path(const char *value);
+int						grow_header_strings(t_map *map, size_t size);
 
 /* parse_and_validate_cub */
 int						parse_and_validate_cub(char *path, t_game *game);
+int						validate_cub(char *path, t_game *game);
 
 /* parse_header.c */
 int						parse_header(const char *path, t_map *map);
@@ -335,36 +698,143 @@ int						parse_header(const char *path, t_map *map);
 /* parse_header_line.c */
 int						parse_header_line(t_map *map, char *line);
 
-/*parse_map.c */
+/* map_load.c */
 int						parse_map(const char *path, t_map *map);
+int						load_valid_map(const char *path, t_game *game);
+int						validate_map_file(const char *path, t_game *game);
+
+/* map_crop.c */
+int						crop_to_reachable(t_game *game);
+void					print_map_stats(const t_map *map);
+
+/* map_reach.c */
+int						flood_map(t_map *map, int spawn_x, int spawn_y,
+							int box[4]);
+
+/* map_rows.c */
+int						open_map_rows(t_row_reader *rd, const char *path,
+							int start);
+const char				*read_map_row(t_row_reader *rd, int *len);
+void					close_map_rows(t_row_reader *rd);
+
+/* map_stream.c */
+void					map_stream_init(t_map_stream *st, int max_width,
+							int max_height, char *too_large);
+int						map_stream_push(t_map_stream *st, const char *row,
+							int len);
+int						map_stream_finish(t_map_stream *st);
+
+/* map_stream_checks.c */
+int						check_map_row(const t_map_stream *st);
+
+/*parse_map.c */
+int						load_map_grid(const char *path, t_map *map,
+							t_map_stream *st);
 
 /*parse_map_utils.c */
 int						max_int(int a, int b);
 int						open_cub_file(const char *path);
 void					print_map_grid(t_map *map);
 void					free_map_grid(t_map *map);
-void					free_partial_grid(t_map *map, int filled_rows);
 
 /* parse_rgb.c */
 int						parse_rgb(const char *value, int rgb_values[RGB_SIZE]);
 
 /* player_setup.c */
+void					set_player_position(t_player *player, int x, int y,
+							char c);
 int						init_player(t_game *game);
 
 /* player_setup_utils.c */
 void					print_player_info(t_player *player);
 
 /* validate_map.c */
+int						check_map_cell(t_map *map, int y, int x);
 int						check_valid_map(t_map *map);
 
+/* validate_map_bands.c */
+int						map_band_count(const t_map *map);
+int						check_band_rows(t_band_check *chk, int jobs);
+
+/* validate_map_rows.c */
+int						check_map_band_row(t_band_check *chk, int y);
+int						check_map_bands(t_map *map, int jobs);
+int						check_map_rows(t_map *map, const int *lens, int y0,
+							int y1);
+
 /* =========================== */
 /*           RENDERS           */
 /* =========================== */
 
+/* background.c */
+void					draw_background(t_game *game);
+
 /* draw_pixels.c*/
 void					draw_pixel_in_buffer(t_game *game, int x, int y,
 							int color);
 
+/* floor_casting.c */
+bool					surface_is_textured(t_game *game, t_header_type id);
+void					draw_floor_ceiling(t_game *game);
+
+/* render_scale.c */
+int						init_render_scale(t_game *game);
+void					set_render_level(t_game *game, int level);
+void					update_render_scale(t_game *game, long frame_us);
+void					cleanup_render_scale(t_game *game);
+
+/* shading.c */
+void					build_shade_tables(t_shade *shade);
+int						shade_level(const t_shade *shade, double dist);
+const unsigned char		*shade_lut(const t_shade *shade, double dist);
+unsigned int			shade_pixel(const unsigned char *shade,
+							unsigned int color);
+double					row_distance(const t_frame *frame, int y);
+
+/* upscale.c */
+void					upscale_frame(t_game *game);
+
+/* kernels.c */
+bool					kernel_table(t_isa isa, t_kernels *out);
+bool					isa_supported(t_isa isa);
+const char				*isa_name(t_isa isa);
+t_kernels				*kernels(void);
+
+/* kernels_dispatch.c */
+void					fill_row(unsigned int *dst, unsigned int color, int n);
+void					copy_row(unsigned int *dst, const unsigned int *src,
+							int n);
+void					upscale_row_2x(unsigned int *dst,
+							const unsigned int *src, int src_w);
+void					sample_wall_bilinear(t_span span, const t_mip *mip);
+void					sample_wall_nearest(t_span span, const t_mip *mip);
+
+/* kernels_scalar.c */
+void					fill_row_scalar(unsigned int *dst, unsigned int color,
+							int n);
+void					copy_row_scalar(unsigned int *dst,
+							const unsigned int *src, int n);
+void					upscale_row_2x_scalar(unsigned int *dst,
+							const unsigned int *src, int src_w);
+
+/* kernels_sse2.c */
+void					fill_row_sse2(unsigned int *dst, unsigned int color,
+							int n);
+void					copy_row_sse2(unsigned int *dst,
+							const unsigned int *src, int n);
+void					upscale_row_2x_sse2(unsigned int *dst,
+							const unsigned int *src, int src_w);
+bool					sse2_kernels(t_kernels *k);
+
+/* kernels_avx2.c */
+void					fill_row_avx2(unsigned int *dst, unsigned int color,
+							int n);
+void					copy_row_avx2(unsigned int *dst,
+							const unsigned int *src, int n);
+void					upscale_row_2x_avx2(unsigned int *dst,
+							const unsigned int *src, int src_w);
+bool					avx2_kernels(t_kernels *k);
+
 /* =========================== */
 /*         RAYCAST             */
 /* =========================== */
@@ -378,34 +848,105 @@ bool					check_hit(t_game *game, t_ray *ray);
 double					calculate_wall_x(t_ray *ray, double pos_x, double pos_y,
 							double wall_dist);
 int						get_wall_direction(t_ray *ray);
+double					max_ray_distance(const t_game *game);
+t_ray_result			ray_hit_result(t_game *game, t_ray *ray);
 
 /* raycast_utils.c */
-int						calculate_tex_x(double wall_x);
-int						get_texture_pixel(t_texture *texture, int tex_x,
-							int tex_y);
+int						calculate_tex_x(double wall_x, int tex_width);
+t_mip					*select_mip(t_texture *texture, int line_height);
 void					draw_textured_wall_slice(t_game *game,
 							t_draw_info info);
 
 /* raycast.c */
+t_draw_info				wall_column_info(t_game *game, int x,
+							t_ray_result result);
+void					cast_column_ray(t_game *game, int x);
+void					draw_column(t_game *game, t_draw_info info);
 void					render_frame(t_game *game);
 
+/* raycast_spans.c */
+void					cast_spans(t_game *game);
+
+/* antialias.c */
+void					draw_walls(t_game *game);
+
+/* antialias_utils.c */
+void					save_column(t_game *game, int x, int start, int end);
+void					accumulate_column(t_game *game, int x, int start,
+							int end);
+void					resolve_column(t_game *game, int x, int start,
+							int end);
+
+/* wall_samplers.c */
+void					sample_wall_nearest_scalar(t_span span,
+							const t_mip *mip);
+bool					can_filter_bilinear(const t_mip *mip);
+void					set_wall_sampler(t_mip *mip);
+
+/* wall_samplers_palette.c */
+void					sample_wall_palette_pow2(t_span span, const t_mip *mip);
+void					sample_wall_palette_generic(t_span span,
+							const t_mip *mip);
+
+/* wall_samplers_bilinear.c */
+void					sample_wall_bilinear_scalar(t_span span,
+							const t_mip *mip);
+
+/* wall_samplers_bilinear_sse2.c */
+void					sample_wall_bilinear_sse2(t_span span,
+							const t_mip *mip);
+
+/* wall_samplers_avx2.c */
+void					sample_wall_nearest_avx2(t_span span,
+							const t_mip *mip);
+
+/* wall_samplers_shaded.c */
+void					sample_wall_shaded_pow2(t_span span, const t_mip *mip);
+void					sample_wall_shaded_generic(t_span span,
+							const t_mip *mip);
+
 /* =========================== */
 /*           UTILS             */
 /* =========================== */
 
+/* alloc_count.c */
+long					*alloc_counter(void);
+void					alloc_counts(long counts[2]);
+void					check_frame_allocs(const long before[2]);
+
+/* arena.c */
+int						arena_init(t_arena *arena, size_t cap);
+void					*arena_alloc(t_arena *arena, size_t size);
+char					*arena_strtrim(t_arena *arena, const char *s,
+							const char *set);
+void					arena_free(t_arena *arena);
+int						arena_append(t_arena *arena, const void *data,
+							size_t size);
+
 /* ascii art */
 void					print_ascii_art_hello(void);
+void					print_startup_info(t_game *game);
 
 /* cleanup_exit.c */
 void					cleanup_textures(t_game *game);
+void					free_texture_atlas(t_atlas *atlas);
 void					free_t_map(t_map *map);
 void					cleanup_game(t_game *game);
 void					cleanup_exit(t_game *game, int status);
 
 /* print_errors.c */
+t_error_log				**error_log(void);
 void					print_errors(char *p1, char *p2, char *p3);
 
 /* rgb_tab_to_int.c */
 int						rgb_tab_to_int(int rgb[RGB_SIZE]);
 
+/* time_utils.c */
+long					get_time_us(void);
+
+/* view.c */
+t_view					view_trim(const char *s, const char *set);
+bool					view_next_field(const char **cursor, char sep,
+							t_view *field);
+
 #endif
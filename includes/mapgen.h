@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapgen.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:16:11 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPGEN_H
+# define MAPGEN_H
+
+/* =========================== */
+/*          INCLUDES           */
+/* =========================== */
+
+# include "cub3d.h"
+
+/* =========================== */
+/*         DEFINE              */
+/* =========================== */
+
+/* usage and argument errors */
+# define MG_USAGE "Usage: ./mapgen <layout> <width> <height> [--seed N]"
+# define MG_USAGE_OPTIONS " [--pose X,Y,NSEW] [--textures SET] [-o file.cub]"
+# define MG_USAGE_LAYOUTS "Layouts: arena, pillars, corridors, maze, spiral"
+# define MG_LAYOUT "Unknown layout: "
+# define MG_SIZE "Invalid map size. Expected: 3 to 4096 cells per side"
+# define MG_SEED "Invalid seed. Expected: a number from 0 to 2147483647"
+# define MG_POSE "Invalid pose. Expected: X,Y,D with D one of N, S, E, W"
+# define MG_POSE_WALL "The player pose is not on an open cell"
+# define MG_TEXTURES "Unknown texture set: "
+# define MG_ALLOC "Allocation of the map grid failed"
+# define MG_OUTPUT "Cannot write the map to: "
+
+/* generation */
+# define MG_MIN_SIDE 3
+# define MG_DEFAULT_SEED 42
+# define MG_DEFAULT_TEXTURES "bricks"
+# define MG_TEXTURE_DIR "assets/textures/"
+# define MG_FLOOR "F 36,26,12\n"
+# define MG_CEILING "C 2,8,18\n"
+/* one pillar field cell in MG_PILLAR_STEP x MG_PILLAR_STEP may hold one */
+# define MG_PILLAR_STEP 3
+
+/* =========================== */
+/*         STRUCTS             */
+/* =========================== */
+
+/* generator settings and the grid being generated, row by row */
+typedef struct s_mapgen
+{
+	char		*cells;
+	int			width;
+	int			height;
+	unsigned	seed;
+	int			pose_x;
+	int			pose_y;
+	char		pose_dir;
+	const char	*textures;
+	const char	*out_path;
+}	t_mapgen;
+
+/* layout name and the function filling the grid with it */
+typedef struct s_layout
+{
+	const char	*name;
+	void		(*fill)(t_mapgen *mg);
+}	t_layout;
+
+/* =========================== */
+/*         FUNCTIONS           */
+/* =========================== */
+
+/* mapgen_args.c */
+int				parse_mapgen_args(int argc, char **argv, t_mapgen *mg,
+					const t_layout **layout);
+
+/* mapgen_layouts.c */
+void			fill_arena(t_mapgen *mg, char inside);
+const t_layout	*get_layouts(void);
+
+/* mapgen_maze.c */
+void			gen_maze(t_mapgen *mg);
+void			gen_spiral(t_mapgen *mg);
+
+/* mapgen_output.c */
+unsigned int	mapgen_rand(t_mapgen *mg);
+int				place_player(t_mapgen *mg);
+int				write_cub_file(t_mapgen *mg);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/13 16:14:14 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/18 16:23:40 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:02:05 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,7 +23,19 @@
 #  define OPEN_MAX 1024
 # endif
 
+/**
+ * @brief Reader state for get_next_line_r(): a file descriptor and the
+ *        data read past the last returned line.
+ */
+typedef struct s_gnl
+{
+	int		fd;
+	char	*stash;
+}	t_gnl;
+
 char	*get_next_line(int fd);
+char	*get_next_line_r(t_gnl *gnl);
+void	gnl_release(t_gnl *gnl);
 void	gnl_clear_fd(int fd);
 int		handle_cleanup_mode(int fd, char **buffer);
 
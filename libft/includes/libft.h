@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/15 14:39:49 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/18 16:04:19 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,6 +26,18 @@
 # include <unistd.h>
 # include <colors.h>
 
+/* size of a t_outbuf, flushed to its fd once full */
+# define FT_OUTBUF_SIZE 4096
+
+/* output buffer: bytes reach fd when it is full or flushed */
+typedef struct s_outbuf
+{
+	int		fd;
+	bool	error;
+	size_t	len;
+	char	data[FT_OUTBUF_SIZE];
+}	t_outbuf;
+
 typedef struct s_list
 {
 	void			*content;
@@ -49,6 +61,13 @@ int		ft_safe_atoi(const char *str, int *out);
 int		ft_safe_atoll(const char *str, long long *out);
 
 //io
+void	ft_outbuf_init(t_outbuf *out, int fd);
+int		ft_outbuf_flush(t_outbuf *out);
+int		ft_outbuf_write(t_outbuf *out, const char *s, size_t n);
+int		ft_outbuf_putchar(t_outbuf *out, char c);
+int		ft_outbuf_putstr(t_outbuf *out, const char *s);
+int		ft_outbuf_putnbr(t_outbuf *out, long n);
+int		ft_outbuf_putfield(t_outbuf *out, const char *label, long n);
 int		ft_putchar_fd(char c, int fd);
 int		ft_putendl_fd(char*s, int fd);
 void	ft_putnbr_fd(int n, int fd);
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_outbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:33:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:33:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Sets up an empty output buffer for a file descriptor.
+ *
+ * @param out Buffer to set up (usually on the caller's stack).
+ * @param fd File descriptor the bytes go to.
+ */
+void	ft_outbuf_init(t_outbuf *out, int fd)
+{
+	out->fd = fd;
+	out->len = 0;
+	out->error = false;
+}
+
+/**
+ * @brief Writes the buffered bytes to the file descriptor, and empties
+ *        the buffer.
+ *
+ * Retries short writes. After a write error the buffer keeps dropping
+ * its bytes and every call returns -1.
+ *
+ * @param out Buffer to flush.
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_flush(t_outbuf *out)
+{
+	size_t	done;
+	ssize_t	ret;
+
+	done = 0;
+	while (!out->error && done < out->len)
+	{
+		ret = write(out->fd, out->data + done, out->len - done);
+		if (ret <= 0)
+			out->error = true;
+		else
+			done += ret;
+	}
+	out->len = 0;
+	if (out->error)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Appends n bytes to the buffer, flushing each time it is full.
+ *
+ * @param out Buffer to write to.
+ * @param s Bytes to append.
+ * @param n Number of bytes.
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_write(t_outbuf *out, const char *s, size_t n)
+{
+	size_t	chunk;
+
+	while (n > 0)
+	{
+		if (out->len == FT_OUTBUF_SIZE && ft_outbuf_flush(out) < 0)
+			return (-1);
+		chunk = FT_OUTBUF_SIZE - out->len;
+		if (chunk > n)
+			chunk = n;
+		ft_memcpy(out->data + out->len, s, chunk);
+		out->len += chunk;
+		s += chunk;
+		n -= chunk;
+	}
+	return (-(int)out->error);
+}
+
+/**
+ * @brief Appends one character to the buffer.
+ *
+ * @param out Buffer to write to.
+ * @param c Character to append.
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_putchar(t_outbuf *out, char c)
+{
+	if (out->len == FT_OUTBUF_SIZE && ft_outbuf_flush(out) < 0)
+		return (-1);
+	out->data[out->len++] = c;
+	return (-(int)out->error);
+}
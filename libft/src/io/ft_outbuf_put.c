@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_outbuf_put.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:33:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:33:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Appends a null-terminated string to the buffer.
+ *
+ * @param out Buffer to write to.
+ * @param s String to append. If NULL, nothing is appended.
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_putstr(t_outbuf *out, const char *s)
+{
+	if (!s)
+		return (-(int)out->error);
+	return (ft_outbuf_write(out, s, ft_strlen(s)));
+}
+
+/**
+ * @brief Appends a number, in decimal, to the buffer.
+ *
+ * @param out Buffer to write to.
+ * @param n Number to append (any long, LONG_MIN included).
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_putnbr(t_outbuf *out, long n)
+{
+	char			digits[21];
+	int				i;
+	unsigned long	u;
+
+	u = n;
+	if (n < 0)
+		u = -(unsigned long)n;
+	i = sizeof(digits);
+	digits[--i] = '0' + u % 10;
+	while (u >= 10)
+	{
+		u /= 10;
+		digits[--i] = '0' + u % 10;
+	}
+	if (n < 0)
+		digits[--i] = '-';
+	return (ft_outbuf_write(out, digits + i, sizeof(digits) - i));
+}
+
+/**
+ * @brief Appends a label, then a number in decimal, to the buffer.
+ *
+ * @param out Buffer to write to.
+ * @param label String written before the number (can be NULL).
+ * @param n Number to append.
+ * @return 0 on success, -1 if a write failed.
+ */
+int	ft_outbuf_putfield(t_outbuf *out, const char *label, long n)
+{
+	ft_outbuf_putstr(out, label);
+	return (ft_outbuf_putnbr(out, n));
+}
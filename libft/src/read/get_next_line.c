@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/13 13:56:26 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/18 17:54:47 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:02:05 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -144,35 +144,30 @@ static char	*read_from_file(int fd, char *buffer)
 }
 
 /**
- * @brief Reads and returns the next line from a file descriptor.
+ * @brief Reads and returns the next line of gnl->fd, reentrant version.
  *
- * Maintains a static buffer per file descriptor to allow successive
- * calls to return one line at a time. The returned line includes the
- * trailing newline if present.
+ * The unread data is kept in gnl->stash, owned by the caller instead of
+ * a static buffer, so several threads can read files at the same time.
+ * Once done with the file, gnl_release() frees what is left in the stash.
  *
- * @param fd File descriptor to read from.
+ * @param gnl File descriptor and its stash (NULL before the first call).
  *
  * @return Pointer to the next line, or NULL on EOF or error.
  */
-char	*get_next_line(int fd)
+char	*get_next_line_r(t_gnl *gnl)
 {
-	static char	*buffer[OPEN_MAX];
-	char		*line;
+	char	*line;
 
-	if (handle_cleanup_mode(fd, buffer))
-		return (NULL);
-	if (fd < 0 || BUFFER_SIZE <= 0 || fd >= OPEN_MAX)
+	if (gnl->fd < 0 || BUFFER_SIZE <= 0)
 		return (NULL);
-	if (!buffer[fd])
-		buffer[fd] = ft_calloc(1, sizeof(char));
-	if (!buffer[fd])
+	if (!gnl->stash)
+		gnl->stash = ft_calloc(1, sizeof(char));
+	if (!gnl->stash)
 		return (NULL);
-	buffer[fd] = read_from_file(fd, buffer[fd]);
-	if (!buffer[fd])
+	gnl->stash = read_from_file(gnl->fd, gnl->stash);
+	if (!gnl->stash)
 		return (NULL);
-	line = extract_line(buffer[fd]);
-	buffer[fd] = leftover(buffer[fd]);
-	if (!buffer[fd])
-		free(buffer[fd]);
+	line = extract_line(gnl->stash);
+	gnl->stash = leftover(gnl->stash);
 	return (line);
 }
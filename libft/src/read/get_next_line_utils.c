@@ -6,12 +6,51 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/18 15:48:46 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/18 17:55:15 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:02:05 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "get_next_line.h"
 
+/**
+ * @brief Reads and returns the next line from a file descriptor.
+ *
+ * Maintains a static buffer per file descriptor to allow successive
+ * calls to return one line at a time. The returned line includes the
+ * trailing newline if present. Not thread safe: use get_next_line_r()
+ * to read from several threads.
+ *
+ * @param fd File descriptor to read from.
+ *
+ * @return Pointer to the next line, or NULL on EOF or error.
+ */
+char	*get_next_line(int fd)
+{
+	static char	*buffer[OPEN_MAX];
+	t_gnl		gnl;
+	char		*line;
+
+	if (handle_cleanup_mode(fd, buffer))
+		return (NULL);
+	if (fd < 0 || fd >= OPEN_MAX)
+		return (NULL);
+	gnl = (t_gnl){.fd = fd, .stash = buffer[fd]};
+	line = get_next_line_r(&gnl);
+	buffer[fd] = gnl.stash;
+	return (line);
+}
+
+/**
+ * @brief Frees the data left in a get_next_line_r() stash.
+ *
+ * @param gnl Reader to reset; its file descriptor is left open.
+ */
+void	gnl_release(t_gnl *gnl)
+{
+	free(gnl->stash);
+	gnl->stash = NULL;
+}
+
 void	gnl_clear_fd(int fd)
 {
 	if (fd < 0 || fd >= OPEN_MAX)
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_mode.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:04:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:48:59 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Default number of check threads: one per online CPU
+ *
+ * @return Thread count, 1 to CHECK_MAX_JOBS
+ */
+static int	default_jobs(void)
+{
+	long	cpus;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus < 1)
+		return (1);
+	if (cpus > CHECK_MAX_JOBS)
+		return (CHECK_MAX_JOBS);
+	return ((int)cpus);
+}
+
+/**
+ * @brief Parses the --jobs value
+ *
+ * @param arg Argument to parse
+ * @param jobs Receives the thread count, 1 to CHECK_MAX_JOBS
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	parse_jobs(const char *arg, int *jobs)
+{
+	if (!ft_safe_atoi(arg, jobs) || *jobs < 1 || *jobs > CHECK_MAX_JOBS)
+	{
+		print_errors(CHECK_JOBS_FORMAT, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Frees the file list of a --check run
+ *
+ * @param check Check run to free
+ */
+static void	free_check(t_check *check)
+{
+	int	i;
+
+	i = 0;
+	while (i < check->count)
+		free(check->files[i++].path);
+	free(check->files);
+	check->files = NULL;
+	check->count = 0;
+}
+
+/**
+ * @brief Batch validator: ./cub3D --check [--jobs N] <file.cub|dir>...
+ *
+ * Runs validate_argument() and validate_cub() on every file,
+ * spread over a thread pool, without opening any MLX connection, so it
+ * runs without a display. Directories are searched recursively for .cub
+ * files. Prints one result line per file, in argument order, then the
+ * totals (see print_check_report()).
+ *
+ * @param argc Argument count
+ * @param argv Argument vector (argv[1] = "--check")
+ * @return EXIT_SUCCESS if every file is valid, EXIT_FAILURE otherwise
+ */
+int	run_check(int argc, char **argv)
+{
+	t_check	check;
+	int		i;
+	int		status;
+
+	check = (t_check){.jobs = default_jobs()};
+	i = 2;
+	if (i < argc && ft_strcmp(argv[i], JOBS_FLAG) == 0)
+	{
+		if (i + 1 >= argc || parse_jobs(argv[i + 1], &check.jobs))
+			return (print_errors(CHECK_USAGE, NULL, NULL), EXIT_FAILURE);
+		i += 2;
+	}
+	if (i >= argc)
+		return (print_errors(CHECK_USAGE, NULL, NULL), EXIT_FAILURE);
+	status = collect_check_paths(&check, argc - i, argv + i);
+	if (status == EXIT_SUCCESS)
+	{
+		run_check_pool(&check);
+		status = print_check_report(&check);
+	}
+	free_check(&check);
+	return (status);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_paths.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:04:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:27:05 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Appends a copy of a path to the check list, growing it as needed
+ *
+ * @param check Check run
+ * @param path Path to add
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	add_path(t_check *check, const char *path)
+{
+	t_check_file	*grown;
+	char			*copy;
+
+	copy = ft_strdup(path);
+	if (copy && check->count == check->capacity)
+	{
+		grown = malloc(sizeof(t_check_file) * (check->capacity * 2 + 16));
+		if (!grown)
+			free(copy);
+		if (!grown)
+			return (print_errors(CHECK_ALLOC, NULL, NULL), EXIT_FAILURE);
+		ft_memcpy(grown, check->files, sizeof(t_check_file) * check->count);
+		free(check->files);
+		check->files = grown;
+		check->capacity = check->capacity * 2 + 16;
+	}
+	if (!copy)
+		return (print_errors(CHECK_ALLOC, NULL, NULL), EXIT_FAILURE);
+	check->files[check->count++] = (t_check_file){.path = copy};
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Adds the .cub files found under a directory, recursively
+ *
+ * Hidden entries are skipped, and so are files without the .cub
+ * extension: they are not maps. Symlinks to directories are skipped too
+ * (is_real_directory()): one pointing back up the tree would never end.
+ * A directory named on the command line is followed even if it is a
+ * symlink.
+ *
+ * @param check Check run
+ * @param dir Directory to search
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	walk_dir(t_check *check, const char *dir)
+{
+	DIR				*stream;
+	struct dirent	*entry;
+	char			*path;
+	int				status;
+
+	stream = opendir(dir);
+	if (!stream)
+		return (print_errors(CHECK_DIR, (char *)dir, NULL), EXIT_FAILURE);
+	status = EXIT_SUCCESS;
+	entry = readdir(stream);
+	while (status == EXIT_SUCCESS && entry)
+	{
+		path = NULL;
+		if (entry->d_name[0] != '.')
+			path = join_path(dir, entry->d_name);
+		if (entry->d_name[0] != '.' && !path)
+			status = (print_errors(CHECK_ALLOC, NULL, NULL), EXIT_FAILURE);
+		else if (path && is_real_directory(path))
+			status = walk_dir(check, path);
+		else if (path && has_cub_extension(entry->d_name))
+			status = add_path(check, path);
+		free(path);
+		entry = readdir(stream);
+	}
+	return (closedir(stream), status);
+}
+
+/**
+ * @brief Builds the list of files to check from the command line
+ *
+ * Files are kept in argument order, whatever their name, so that
+ * validate_argument() reports bad ones. The files found under a directory
+ * are sorted by path, so the report does not depend on readdir() order.
+ *
+ * @param check Check run receiving the files
+ * @param argc Number of paths
+ * @param argv Files and directories to check
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+int	collect_check_paths(t_check *check, int argc, char **argv)
+{
+	int	i;
+	int	first;
+
+	i = 0;
+	while (i < argc)
+	{
+		first = check->count;
+		if (is_directory(argv[i]))
+		{
+			if (walk_dir(check, argv[i]) != EXIT_SUCCESS)
+				return (EXIT_FAILURE);
+			qsort(check->files + first, check->count - first,
+				sizeof(t_check_file), compare_check_paths);
+		}
+		else if (add_path(check, argv[i]) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+		i++;
+	}
+	return (EXIT_SUCCESS);
+}
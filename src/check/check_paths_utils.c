@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_paths_utils.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:04:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:27:05 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Tells if a path names a directory (following symlinks)
+ *
+ * @param path Path to test
+ * @return true for a directory, false otherwise or on error
+ */
+bool	is_directory(const char *path)
+{
+	struct stat	st;
+
+	return (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
+
+/**
+ * @brief Tells if a path names a directory itself, not a symlink to one
+ *
+ * Used while walking a tree: a symlink to a directory is not followed,
+ * so a link to the directory itself or to a parent cannot make the walk
+ * loop.
+ *
+ * @param path Path to test
+ * @return true for a directory, false for a symlink, a file or on error
+ */
+bool	is_real_directory(const char *path)
+{
+	struct stat	st;
+
+	return (lstat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
+
+/**
+ * @brief Tells if a file name ends with the .cub extension
+ *
+ * @param name File name
+ * @return true for a .cub name, false otherwise
+ */
+bool	has_cub_extension(const char *name)
+{
+	size_t	len;
+	size_t	ext_len;
+
+	len = ft_strlen(name);
+	ext_len = ft_strlen(CHECK_EXTENSION);
+	return (len > ext_len
+		&& ft_strcmp(name + len - ext_len, CHECK_EXTENSION) == 0);
+}
+
+/**
+ * @brief Joins a directory path and an entry name with a '/'
+ *
+ * @param dir Directory path
+ * @param name Entry name
+ * @return Newly allocated path, or NULL on allocation failure
+ */
+char	*join_path(const char *dir, const char *name)
+{
+	char	*prefix;
+	char	*path;
+
+	prefix = ft_strjoin(dir, "/");
+	if (!prefix)
+		return (NULL);
+	path = ft_strjoin(prefix, name);
+	free(prefix);
+	return (path);
+}
+
+/**
+ * @brief Orders two check files by path, for qsort()
+ *
+ * @param a First t_check_file
+ * @param b Second t_check_file
+ * @return Negative, zero or positive, as ft_strcmp()
+ */
+int	compare_check_paths(const void *a, const void *b)
+{
+	return (ft_strcmp(((const t_check_file *)a)->path,
+			((const t_check_file *)b)->path));
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_pool.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:04:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:09:31 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Validates one file, keeping its errors in its own log
+ *
+ * Runs the same checks as a normal launch, up to the map validation,
+ * with the map streamed instead of loaded (validate_cub()). The parser
+ * keeps no state outside of the t_game it fills, so any number of files
+ * can be checked at the same time.
+ *
+ * @param file File to check, receives the outcome
+ */
+static void	check_file(t_check_file *file)
+{
+	t_game	game;
+
+	*error_log() = &file->log;
+	init_t_game(&game);
+	file->ok = validate_argument(file->path) == EXIT_SUCCESS
+		&& validate_cub(file->path, &game) == EXIT_SUCCESS;
+	free_t_map(&game.map);
+	*error_log() = NULL;
+}
+
+/**
+ * @brief Worker loop: takes the next unchecked file until none is left
+ *
+ * @param arg The shared t_check
+ * @return NULL
+ */
+static void	*check_worker(void *arg)
+{
+	t_check	*check;
+	int		i;
+
+	check = arg;
+	while (true)
+	{
+		pthread_mutex_lock(&check->lock);
+		i = check->next++;
+		pthread_mutex_unlock(&check->lock);
+		if (i >= check->count)
+			return (NULL);
+		check_file(&check->files[i]);
+	}
+}
+
+/**
+ * @brief Checks every file of the list on check->jobs threads
+ *
+ * The calling thread is one of the workers. Files are handed out one by
+ * one, so a slow file never holds back a whole batch. If a thread cannot
+ * be started, the ones already running take over its share.
+ *
+ * @param check Check run; each file receives its outcome
+ */
+void	run_check_pool(t_check *check)
+{
+	pthread_t	threads[CHECK_MAX_JOBS];
+	int			started;
+
+	check->next = 0;
+	pthread_mutex_init(&check->lock, NULL);
+	started = 0;
+	while (started + 1 < check->jobs && started + 1 < check->count
+		&& pthread_create(&threads[started], NULL, check_worker, check) == 0)
+		started++;
+	check_worker(check);
+	while (started > 0)
+		pthread_join(threads[--started], NULL);
+	pthread_mutex_destroy(&check->lock);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:04:19 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:04:19 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Prints the outcome of a --check run, one line per file
+ *
+ * Tab separated, in list order, for scripts to parse:
+ *   PASS	<path>
+ *   FAIL	<path>	<error messages, joined by "; ">
+ *   TOTAL	<files>	PASS	<passed>	FAIL	<failed>
+ *
+ * @param check Finished check run
+ * @return EXIT_SUCCESS if every file passed, EXIT_FAILURE otherwise
+ */
+int	print_check_report(const t_check *check)
+{
+	int	i;
+	int	passed;
+
+	passed = 0;
+	i = 0;
+	while (i < check->count)
+	{
+		if (check->files[i].ok)
+			printf("PASS\t%s\n", check->files[i].path);
+		else
+			printf("FAIL\t%s\t%s\n", check->files[i].path,
+				check->files[i].log.msg);
+		passed += check->files[i].ok;
+		i++;
+	}
+	printf("TOTAL\t%d\tPASS\t%d\tFAIL\t%d\n", check->count, passed,
+		check->count - passed);
+	if (passed != check->count)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_hooks.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:29:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:40 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/* glibc's own allocator, wrapped below to count the calls */
+void	*__libc_malloc(size_t size);
+void	*__libc_calloc(size_t count, size_t size);
+void	*__libc_realloc(void *ptr, size_t size);
+void	__libc_free(void *ptr);
+
+/**
+ * @brief Counting malloc(), only linked with ALLOC_DEBUG=1 (and into the
+ *        tests that count allocations).
+ */
+void	*malloc(size_t size)
+{
+	__atomic_add_fetch(&alloc_counter()[0], 1, __ATOMIC_RELAXED);
+	return (__libc_malloc(size));
+}
+
+void	*calloc(size_t count, size_t size)
+{
+	__atomic_add_fetch(&alloc_counter()[0], 1, __ATOMIC_RELAXED);
+	return (__libc_calloc(count, size));
+}
+
+/**
+ * @brief Counting realloc(): a call that only frees (size 0) counts as
+ *        a free.
+ */
+void	*realloc(void *ptr, size_t size)
+{
+	if (size > 0)
+		__atomic_add_fetch(&alloc_counter()[0], 1, __ATOMIC_RELAXED);
+	else if (ptr)
+		__atomic_add_fetch(&alloc_counter()[1], 1, __ATOMIC_RELAXED);
+	return (__libc_realloc(ptr, size));
+}
+
+/**
+ * @brief Counting free(); free(NULL) is not counted.
+ */
+void	free(void *ptr)
+{
+	if (ptr)
+		__atomic_add_fetch(&alloc_counter()[1], 1, __ATOMIC_RELAXED);
+	__libc_free(ptr);
+}
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:53:40 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 19:54:45 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:34:33 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -51,7 +51,8 @@ t_key_binding	*get_key_bindings(t_game *game)
  * @brief Handles key press events using function pointers
  *
  * Iterates through key bindings and sets the corresponding flag to true
- * when a registered key is pressed. ESC key triggers immediate exit.
+ * when a registered key is pressed. ESC key triggers immediate exit,
+ * B toggles bilinear wall filtering.
  *
  * @param keycode X11 keycode of the pressed key
  * @param param Pointer to game structure (void* from MLX, must cast)
@@ -66,6 +67,8 @@ int	handle_keypress(int keycode, void *param)
 	game = (t_game *)param;
 	if (keycode == XK_Escape)
 		cleanup_exit(game, EXIT_SUCCESS);
+	if (keycode == XK_b)
+		game->bilinear = !game->bilinear;
 	bindings = get_key_bindings(game);
 	i = 0;
 	while (bindings[i].action)
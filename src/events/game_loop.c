@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:54:27 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 19:51:36 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:24:57 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,26 +44,60 @@ static int	should_render_frame(void)
 }
 
 /**
- * @brief Main game loop - called every frame by MLX
+ * @brief Shows the number of supersampled columns of the last frame
  *
- * Executes the main rendering pipeline:
- * 1. Limits FPS to 60 for consistent movement speed
- * 2. Processes input - checks which keys are pressed and executes actions
- * 3. Renders the scene - casts WINDOWS_X rays (one per screen column)
- * 4. Displays the result - pushes image buffer to window
+ * Only with --aa. The text is built on the stack, so nothing is
+ * allocated per frame.
  *
- * @param param Pointer to game structure (void* from MLX, must cast)
- * @return EXIT_SUCCESS
+ * @param game Pointer to game structure
  */
-int	game_loop(void *param)
+static void	show_aa_columns(t_game *game)
+{
+	char	text[32];
+	int		len;
+	int		digits;
+	int		n;
+
+	if (game->aa_samples < 2)
+		return ;
+	len = ft_strlen(AA_STATS_MSG);
+	ft_memcpy(text, AA_STATS_MSG, len);
+	n = game->frame.aa_columns;
+	digits = 1;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits++;
+	}
+	text[len + digits] = '\0';
+	n = game->frame.aa_columns;
+	while (digits-- > 0)
+	{
+		text[len + digits] = '0' + n % 10;
+		n /= 10;
+	}
+	mlx_string_put(game->mlx, game->win, 10, 20, AA_STATS_COLOR, text);
+}
+
+/**
+ * @brief Runs one frame into the window image, without displaying it
+ *
+ * 1. Processes input - checks which keys are pressed and executes actions
+ * 2. Renders the scene - casts one ray per column of the render target
+ * 3. Upscales the render into the window image if running below full
+ *    resolution, then feeds the frame time to the resolution controller
+ *
+ * Works on the buffers allocated at startup only: no frame after the
+ * first one calls the allocator (see check_frame_allocs()).
+ *
+ * @param game Pointer to game structure
+ */
+void	run_frame(t_game *game)
 {
-	t_game			*game;
 	t_key_binding	*bindings;
 	int				i;
+	long			start;
 
-	if (!should_render_frame())
-		return (EXIT_SUCCESS);
-	game = (t_game *)param;
 	bindings = get_key_bindings(game);
 	i = 0;
 	while (bindings[i].action)
@@ -72,7 +106,38 @@ int	game_loop(void *param)
 			bindings[i].action(game);
 		i++;
 	}
+	start = get_time_us();
 	render_frame(game);
+	upscale_frame(game);
+	update_render_scale(game, get_time_us() - start);
+}
+
+/**
+ * @brief Main game loop - called every frame by MLX
+ *
+ * Limits FPS to 60 for consistent movement speed, runs the frame
+ * (run_frame()), then pushes the image buffer to the window, with the
+ * supersampled column count when edge anti-aliasing is on. A build made
+ * with ALLOC_DEBUG=1 warns about any frame that called the allocator.
+ * The counters are read at the end of each frame, so each check covers
+ * a whole event-loop round: the input handlers mlx ran since the last
+ * frame, the skipped calls, and the frame itself.
+ *
+ * @param param Pointer to game structure (void* from MLX, must cast)
+ * @return EXIT_SUCCESS
+ */
+int	game_loop(void *param)
+{
+	static long	allocs[2];
+	t_game		*game;
+
+	if (!should_render_frame())
+		return (EXIT_SUCCESS);
+	game = (t_game *)param;
+	run_frame(game);
 	mlx_put_image_to_window(game->mlx, game->win, game->img, 0, 0);
+	show_aa_columns(game);
+	check_frame_allocs(allocs);
+	alloc_counts(allocs);
 	return (EXIT_SUCCESS);
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 18:03:01 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/12/27 19:53:17 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:55:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,7 +31,7 @@ int	handle_mouse_move(int x, int y, void *param)
 	int		delta_x;
 
 	game = (t_game *)param;
-	if (x <= 5 || x >= WINDOWS_X - 5)
+	if (x <= 5 || x >= game->win_w - 5)
 		return (EXIT_SUCCESS);
 	delta_x = x - game->last_mouse_x;
 	if (delta_x != 0)
@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_atlas.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:10:30 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:22:03 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Returns the atlas space taken by one level of a texture
+ *
+ * Palettised levels take 1 byte per texel, the others 4. The size is
+ * rounded up to a whole number of ATLAS_ALIGN blocks so every level
+ * starts on a cache line boundary.
+ *
+ * @param tex Texture laid out by layout_mip_levels()
+ * @param level Level index
+ * @return Size in bytes
+ */
+static size_t	level_size(const t_texture *tex, int level)
+{
+	size_t	bytes;
+
+	bytes = (size_t)tex->mips[level].width * tex->mips[level].height;
+	if (tex->palette_size == 0)
+		bytes *= sizeof(unsigned int);
+	return ((bytes + ATLAS_ALIGN - 1) / ATLAS_ALIGN * ATLAS_ALIGN);
+}
+
+/**
+ * @brief Lays out every loaded texture and sums up the atlas size
+ *
+ * Textures flagged with palettise get a palette here if they have at
+ * most PALETTE_SIZE colors, and keep 32-bit texels otherwise. With fog
+ * on, palettised textures also get room for one fogged palette per
+ * fog level.
+ *
+ * @param textures Texture table, entries without addr are skipped
+ * @param count Number of entries in the table
+ * @param shade Fog tables, NULL when fog is off
+ * @return Total atlas size in bytes
+ */
+static size_t	atlas_size(t_texture *textures, int count,
+		const t_shade *shade)
+{
+	size_t	total;
+	int		i;
+	int		level;
+
+	total = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (textures[i].addr)
+		{
+			layout_mip_levels(&textures[i]);
+			textures[i].palette_size = 0;
+			if (textures[i].palettise && collect_palette(&textures[i])
+				&& shade)
+				total += SHADED_PALETTES_SIZE;
+			level = 0;
+			while (level < textures[i].mip_count)
+			{
+				total += level_size(&textures[i], level);
+				level++;
+			}
+		}
+		i++;
+	}
+	return (total);
+}
+
+/**
+ * @brief Fills the levels of a texture placed in the atlas
+ *
+ * Copies the loaded image (addr, line_len) row by row into level 0 and
+ * builds the smaller levels from it, or converts everything to palette
+ * indices for a palettised texture (and fills its fogged palettes).
+ *
+ * @param tex Texture with every level placed
+ * @param shade Fog tables, NULL when fog is off
+ */
+static void	fill_levels(t_texture *tex, const t_shade *shade)
+{
+	int	y;
+
+	if (tex->palette_size > 0)
+	{
+		build_palette_levels(tex);
+		if (tex->shaded_palettes)
+			build_shaded_palettes(tex, shade);
+		return ;
+	}
+	y = 0;
+	while (y < tex->height)
+	{
+		copy_row(tex->mips[0].pixels + y * tex->mips[0].stride,
+			(unsigned int *)(tex->addr + y * tex->line_len), tex->width);
+		y++;
+	}
+	build_mipmaps(tex);
+}
+
+/**
+ * @brief Places all levels of a texture in the atlas and fills them
+ *
+ * Each level gets its storage (32-bit pixels or 8-bit indices) and the
+ * wall sampler matching its size and format. The fogged palettes of a
+ * palettised texture go first, when fog is on.
+ *
+ * @param tex Texture laid out by layout_mip_levels()
+ * @param cursor Next free aligned byte of the atlas, advanced past the
+ *               texture
+ * @param shade Fog tables, NULL when fog is off
+ */
+static void	place_texture(t_texture *tex, unsigned char **cursor,
+		const t_shade *shade)
+{
+	int	i;
+
+	tex->shaded_palettes = NULL;
+	if (tex->palette_size > 0 && shade)
+		tex->shaded_palettes = (unsigned int *)*cursor;
+	if (tex->shaded_palettes)
+		*cursor += SHADED_PALETTES_SIZE;
+	i = 0;
+	while (i < tex->mip_count)
+	{
+		tex->mips[i].pixels = NULL;
+		tex->mips[i].indices = NULL;
+		tex->mips[i].palette = NULL;
+		if (tex->palette_size > 0)
+		{
+			tex->mips[i].indices = *cursor;
+			tex->mips[i].palette = tex->palette;
+		}
+		else
+			tex->mips[i].pixels = (unsigned int *)*cursor;
+		*cursor += level_size(tex, i);
+		set_wall_sampler(&tex->mips[i]);
+		i++;
+	}
+	fill_levels(tex, shade);
+}
+
+/**
+ * @brief Packs every loaded texture and its mip chain into one atlas
+ *
+ * All levels of all textures live in a single ATLAS_ALIGN aligned
+ * allocation, each level starting on its own cache line. The texture
+ * table then only describes where each level is (t_texture.mips), and
+ * switching texture between columns stays inside one memory region.
+ * The source images are not needed afterwards.
+ *
+ * @param atlas Atlas to fill
+ * @param textures Texture table, entries without addr are skipped
+ * @param count Number of entries in the table
+ * @param shade Fog tables, ignored when NULL or fog is off
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on allocation failure
+ */
+int	build_texture_atlas(t_atlas *atlas, t_texture *textures, int count,
+		const t_shade *shade)
+{
+	unsigned char	*cursor;
+	int				i;
+
+	if (shade && shade->fog_dist <= 0)
+		shade = NULL;
+	atlas->size = atlas_size(textures, count, shade);
+	atlas->raw = malloc(atlas->size + ATLAS_ALIGN);
+	if (!atlas->raw)
+	{
+		print_errors(TEXTURE_ATLAS, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	atlas->data = (unsigned char *)(((unsigned long)atlas->raw
+				+ ATLAS_ALIGN - 1) & ~(unsigned long)(ATLAS_ALIGN - 1));
+	cursor = atlas->data;
+	i = 0;
+	while (i < count)
+	{
+		if (textures[i].addr)
+			place_texture(&textures[i], &cursor, shade);
+		i++;
+	}
+	return (EXIT_SUCCESS);
+}
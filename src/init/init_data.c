@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:56:50 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 19:56:34 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,9 @@
  *
  * This function zeroes out the entire t_game structure, including
  * all nested structs such as t_map and t_player.
- * Centers the mouse tracking position to screen center.
+ * Sets the default window size (WINDOWS_X x WINDOWS_Y), which can be
+ * overridden from the command line, and centers the mouse tracking
+ * position on it. Startup output defaults to VERBOSITY_NORMAL.
  *
  * @param game Pointer to the t_game structure to initialize.
  *
@@ -28,6 +30,9 @@ void	init_t_game(t_game *game)
 	if (!game)
 		return ;
 	ft_bzero(game, sizeof(t_game));
-	game->last_mouse_x = WINDOWS_X / 2;
-	game->last_mouse_y = WINDOWS_Y / 2;
+	game->win_w = WINDOWS_X;
+	game->win_h = WINDOWS_Y;
+	game->verbosity = VERBOSITY_NORMAL;
+	game->last_mouse_x = game->win_w / 2;
+	game->last_mouse_y = game->win_h / 2;
 }
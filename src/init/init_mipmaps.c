@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_mipmaps.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:00:57 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:14:25 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Averages four 0xAARRGGBB pixels channel by channel
+ *
+ * @param px Array of the 4 source pixels
+ * @return Rounded per-channel average
+ */
+unsigned int	average_pixels(const unsigned int px[4])
+{
+	unsigned int	result;
+	unsigned int	sum;
+	int				shift;
+
+	result = 0;
+	shift = 0;
+	while (shift < 32)
+	{
+		sum = ((px[0] >> shift) & 0xFF) + ((px[1] >> shift) & 0xFF)
+			+ ((px[2] >> shift) & 0xFF) + ((px[3] >> shift) & 0xFF);
+		result |= ((sum + 2) / 4) << shift;
+		shift += 8;
+	}
+	return (result);
+}
+
+/**
+ * @brief Fills one row of a mip level with a 2x2 box filter
+ *
+ * Source coordinates are clamped so odd sizes reuse their last row or
+ * column instead of reading past the edge.
+ *
+ * @param src Larger level to read from
+ * @param dst Smaller level to fill (pixels already allocated)
+ * @param y Row of dst to fill
+ */
+static void	downsample_row(const t_mip *src, t_mip *dst, int y)
+{
+	unsigned int	px[4];
+	int				x;
+	int				x1;
+	int				y1;
+
+	y1 = 2 * y + 1;
+	if (y1 >= src->height)
+		y1 = src->height - 1;
+	x = 0;
+	while (x < dst->width)
+	{
+		x1 = 2 * x + 1;
+		if (x1 >= src->width)
+			x1 = src->width - 1;
+		px[0] = src->pixels[2 * y * src->stride + 2 * x];
+		px[1] = src->pixels[2 * y * src->stride + x1];
+		px[2] = src->pixels[y1 * src->stride + 2 * x];
+		px[3] = src->pixels[y1 * src->stride + x1];
+		dst->pixels[y * dst->stride + x] = average_pixels(px);
+		x++;
+	}
+}
+
+/**
+ * @brief Fills a mip level from the level above it
+ *
+ * @param src Larger level to read from
+ * @param dst Smaller level to fill (pixels already allocated)
+ */
+static void	downsample_level(const t_mip *src, t_mip *dst)
+{
+	int	y;
+
+	y = 0;
+	while (y < dst->height)
+	{
+		downsample_row(src, dst, y);
+		y++;
+	}
+}
+
+/**
+ * @brief Works out the size of every level of a texture
+ *
+ * Level 0 is the full texture; each next level halves both sides (down
+ * to 1) until the 1x1 level or MIP_LEVELS. Rows are stored tightly
+ * (stride = width). Storage and samplers are set later by
+ * build_texture_atlas().
+ *
+ * @param tex Texture with width and height set
+ */
+void	layout_mip_levels(t_texture *tex)
+{
+	t_mip	*mips;
+	int		i;
+
+	mips = tex->mips;
+	mips[0].width = tex->width;
+	mips[0].height = tex->height;
+	i = 1;
+	while (i < MIP_LEVELS && (mips[i - 1].width > 1 || mips[i - 1].height > 1))
+	{
+		mips[i].width = mips[i - 1].width / 2;
+		if (mips[i].width < 1)
+			mips[i].width = 1;
+		mips[i].height = mips[i - 1].height / 2;
+		if (mips[i].height < 1)
+			mips[i].height = 1;
+		i++;
+	}
+	tex->mip_count = i;
+	i = 0;
+	while (i < tex->mip_count)
+	{
+		mips[i].stride = mips[i].width;
+		i++;
+	}
+}
+
+/**
+ * @brief Builds the mip chain of a texture
+ *
+ * Every smaller level halves the previous one with a box filter, so
+ * distant walls read a small block of memory instead of striding
+ * through the full size texture.
+ *
+ * @param tex Texture laid out by layout_mip_levels(), with level 0
+ *            filled and every level placed in the atlas
+ */
+void	build_mipmaps(t_texture *tex)
+{
+	int	i;
+
+	i = 1;
+	while (i < tex->mip_count)
+	{
+		downsample_level(&tex->mips[i - 1], &tex->mips[i]);
+		i++;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:57:20 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/28 00:01:28 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:55:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,6 +30,7 @@ static void	cleanup_partial_mlx_init(t_game *game)
 		mlx_destroy_image(game->mlx, game->img);
 		game->img = NULL;
 	}
+	cleanup_render_scale(game);
 	if (game->win)
 	{
 		mlx_destroy_window(game->mlx, game->win);
@@ -66,7 +67,7 @@ static int	init_game_connection(t_game *game)
 /**
  * @brief Creates the game window with specified dimensions
  *
- * Opens a new window via X11 server using dimensions from defines.
+ * Opens a new window via X11 server using the size chosen at startup.
  * Requires a valid MLX connection to exist beforehand.
  *
  * @param game Pointer to main game structure (must have valid mlx pointer)
@@ -74,7 +75,8 @@ static int	init_game_connection(t_game *game)
  */
 static int	init_game_windows(t_game *game)
 {
-	game->win = mlx_new_window(game->mlx, WINDOWS_X, WINDOWS_Y, WINDOWS_MSG);
+	game->win = mlx_new_window(game->mlx, game->win_w, game->win_h,
+			WINDOWS_MSG);
 	if (!game->win)
 	{
 		print_errors(WIN_INIT, NULL, NULL);
@@ -94,7 +96,7 @@ static int	init_game_windows(t_game *game)
  */
 static int	init_game_image_buffer(t_game *game)
 {
-	game->img = mlx_new_image(game->mlx, WINDOWS_X, WINDOWS_Y);
+	game->img = mlx_new_image(game->mlx, game->win_w, game->win_h);
 	if (!game->img)
 	{
 		print_errors(IMG_INIT, NULL, NULL);
@@ -113,7 +115,8 @@ static int	init_game_image_buffer(t_game *game)
 /**
  * @brief Master initialization function for all MLX components
  *
- * Initializes MLX connection, window, and image buffer in required order.
+ * Initializes MLX connection, window, image buffer and the dynamic
+ * resolution render buffer in required order.
  * Performs cleanup and returns error if any step fails.
  *
  * @param game Pointer to main game structure
@@ -128,7 +131,8 @@ int	init_graphics(t_game *game)
 		cleanup_partial_mlx_init(game);
 		return (EXIT_FAILURE);
 	}
-	if (validate_window_size(game->mlx) != EXIT_SUCCESS)
+	if (validate_window_size(game->mlx, game->win_w, game->win_h)
+		!= EXIT_SUCCESS)
 	{
 		cleanup_partial_mlx_init(game);
 		return (EXIT_FAILURE);
@@ -138,7 +142,8 @@ int	init_graphics(t_game *game)
 		cleanup_partial_mlx_init(game);
 		return (EXIT_FAILURE);
 	}
-	if (init_game_image_buffer(game) != EXIT_SUCCESS)
+	if (init_game_image_buffer(game) != EXIT_SUCCESS
+		|| init_render_scale(game) != EXIT_SUCCESS)
 	{
 		cleanup_partial_mlx_init(game);
 		return (EXIT_FAILURE);
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 23:39:47 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/12/28 00:05:47 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:55:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,29 +15,31 @@
 /**
  * @brief Validates window dimensions against screen capacity
  *
- * Ensures WINDOWS_X/Y are within playable bounds and fit on screen.
- * Uses 95% screen safety margin (leaves room for taskbar/borders).
+ * Ensures the requested window size is within playable bounds and fits
+ * on screen.
  *
  * @param mlx Valid MLX connection pointer
+ * @param width Requested window width in pixels
+ * @param height Requested window height in pixels
  * @return EXIT_SUCCESS if valid, EXIT_FAILURE otherwise
  */
-int	validate_window_size(void *mlx)
+int	validate_window_size(void *mlx, int width, int height)
 {
 	int	screen_w;
 	int	screen_h;
 
-	if (WINDOWS_X < MIN_SCREEN_WIDTH || WINDOWS_Y < MIN_SCREEN_HEIGHT)
+	if (width < MIN_SCREEN_WIDTH || height < MIN_SCREEN_HEIGHT)
 	{
 		print_errors(WIN_TOO_SMALL, NULL, NULL);
 		return (EXIT_FAILURE);
 	}
 	mlx_get_screen_size(mlx, &screen_w, &screen_h);
-	if (WINDOWS_X > screen_w || WINDOWS_Y > screen_h
-		|| WINDOWS_X > MAX_SCREEN_WIDTH || WINDOWS_Y > MAX_SCREEN_HEIGHT)
+	if (width > screen_w || height > screen_h
+		|| width > MAX_SCREEN_WIDTH || height > MAX_SCREEN_HEIGHT)
 	{
 		print_errors(WIN_TOO_LARGE, NULL, NULL);
 		printf("Window: %dx%d | Screen: %dx%d | Max allowed: %dx%d\n",
-			WINDOWS_X, WINDOWS_Y, screen_w, screen_h,
+			width, height, screen_w, screen_h,
 			MAX_SCREEN_WIDTH, MAX_SCREEN_HEIGHT);
 		return (EXIT_FAILURE);
 	}
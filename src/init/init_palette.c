@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_palette.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:13:35 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:54:39 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Squared distance between two 0xAARRGGBB colors
+ *
+ * @param a First color
+ * @param b Second color
+ * @return Sum of the squared differences of the 4 channels
+ */
+static int	color_distance(unsigned int a, unsigned int b)
+{
+	int	total;
+	int	diff;
+	int	shift;
+
+	total = 0;
+	shift = 0;
+	while (shift < 32)
+	{
+		diff = (int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF);
+		total += diff * diff;
+		shift += 8;
+	}
+	return (total);
+}
+
+/**
+ * @brief Finds the palette entry closest to a color
+ *
+ * Stops early on an exact match, which is the common case for level 0.
+ *
+ * @param tex Texture with its palette filled
+ * @param color Color to look up
+ * @return Index of the closest entry (0 if the palette is empty)
+ */
+unsigned char	nearest_palette_index(const t_texture *tex, unsigned int color)
+{
+	int	best;
+	int	best_dist;
+	int	dist;
+	int	i;
+
+	best = 0;
+	best_dist = INT_MAX;
+	i = 0;
+	while (i < tex->palette_size && best_dist > 0)
+	{
+		dist = color_distance(tex->palette[i], color);
+		if (dist < best_dist)
+		{
+			best = i;
+			best_dist = dist;
+		}
+		i++;
+	}
+	return ((unsigned char)best);
+}
+
+/**
+ * @brief Adds a color to the palette unless it is already there
+ *
+ * Membership is an equality scan: nearest_palette_index() would compute
+ * a distance per entry for the same answer, and is kept for quantising.
+ *
+ * @param tex Texture whose palette is being collected
+ * @param color Color of one texel
+ * @return false if the color is new and the palette is already full
+ */
+static bool	add_palette_color(t_texture *tex, unsigned int color)
+{
+	int	i;
+
+	i = 0;
+	while (i < tex->palette_size)
+		if (tex->palette[i++] == color)
+			return (true);
+	if (tex->palette_size == PALETTE_SIZE)
+		return (false);
+	tex->palette[tex->palette_size] = color;
+	tex->palette_size++;
+	return (true);
+}
+
+/**
+ * @brief Collects the distinct colors of a loaded texture
+ *
+ * XPM textures are palette based, so most use far fewer than
+ * PALETTE_SIZE colors. Gives up as soon as there are more.
+ *
+ * @param tex Texture with addr, line_len, width and height set
+ * @return true if the texture fits in a palette (palette and
+ *         palette_size filled), false otherwise (palette_size = 0)
+ */
+bool	collect_palette(t_texture *tex)
+{
+	unsigned int	*row;
+	int				x;
+	int				y;
+
+	tex->palette_size = 0;
+	y = 0;
+	while (y < tex->height)
+	{
+		row = (unsigned int *)(tex->addr + y * tex->line_len);
+		x = 0;
+		while (x < tex->width)
+		{
+			if (!add_palette_color(tex, row[x]))
+			{
+				tex->palette_size = 0;
+				return (false);
+			}
+			x++;
+		}
+		y++;
+	}
+	return (true);
+}
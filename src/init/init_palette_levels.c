@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_palette_levels.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:13:55 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:22:03 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Stores the palette index of every texel of the loaded image
+ *
+ * @param tex Palettised texture, level 0 placed in the atlas
+ */
+static void	fill_base_level(t_texture *tex)
+{
+	unsigned int	*row;
+	int				x;
+	int				y;
+
+	y = 0;
+	while (y < tex->height)
+	{
+		row = (unsigned int *)(tex->addr + y * tex->line_len);
+		x = 0;
+		while (x < tex->width)
+		{
+			tex->mips[0].indices[y * tex->mips[0].stride + x]
+				= nearest_palette_index(tex, row[x]);
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Fills one row of a palettised mip level
+ *
+ * Box filters the 2x2 source texels in full color, then stores the
+ * index of the closest palette entry. Source coordinates are clamped
+ * like in the 32-bit mip chain.
+ *
+ * @param tex Palettised texture
+ * @param dst Level to fill, an entry of tex->mips after level 0 (the
+ *            level above it is dst - 1)
+ * @param y Row to fill
+ */
+static void	downsample_indexed_row(t_texture *tex, t_mip *dst, int y)
+{
+	const t_mip		*src;
+	unsigned int	px[4];
+	int				x;
+	int				x1;
+	int				y1;
+
+	src = dst - 1;
+	y1 = 2 * y + 1;
+	if (y1 >= src->height)
+		y1 = src->height - 1;
+	x = 0;
+	while (x < dst->width)
+	{
+		x1 = 2 * x + 1;
+		if (x1 >= src->width)
+			x1 = src->width - 1;
+		px[0] = tex->palette[src->indices[2 * y * src->stride + 2 * x]];
+		px[1] = tex->palette[src->indices[2 * y * src->stride + x1]];
+		px[2] = tex->palette[src->indices[y1 * src->stride + 2 * x]];
+		px[3] = tex->palette[src->indices[y1 * src->stride + x1]];
+		dst->indices[y * dst->stride + x]
+			= nearest_palette_index(tex, average_pixels(px));
+		x++;
+	}
+}
+
+/**
+ * @brief Fills every level of a palettised texture
+ *
+ * Level 0 stores the exact palette index of each source texel; the
+ * smaller levels are box filtered and mapped back to the palette, so
+ * every level shares the texture's single color table.
+ *
+ * @param tex Texture with its palette collected and its levels placed
+ */
+void	build_palette_levels(t_texture *tex)
+{
+	int	level;
+	int	y;
+
+	fill_base_level(tex);
+	level = 1;
+	while (level < tex->mip_count)
+	{
+		y = 0;
+		while (y < tex->mips[level].height)
+		{
+			downsample_indexed_row(tex, &tex->mips[level], y);
+			y++;
+		}
+		level++;
+	}
+}
+
+/**
+ * @brief Precomputes the fogged copies of a texture's palette
+ *
+ * Copy l is the palette seen through fog level l, so a palettised wall
+ * is fogged by switching color table once per column instead of
+ * shading every pixel.
+ *
+ * @param tex Palettised texture with shaded_palettes placed in the atlas
+ *            (SHADE_LEVELS tables of PALETTE_SIZE colors)
+ * @param shade Fog tables
+ */
+void	build_shaded_palettes(t_texture *tex, const t_shade *shade)
+{
+	int	level;
+	int	i;
+
+	level = 0;
+	while (level < SHADE_LEVELS)
+	{
+		i = 0;
+		while (i < PALETTE_SIZE)
+		{
+			tex->shaded_palettes[level * PALETTE_SIZE + i]
+				= shade_pixel(shade->lut[level], tex->palette[i]);
+			i++;
+		}
+		level++;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:57:30 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 13:57:33 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:24:41 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,8 @@
   * @brief Loads a single texture from an .xpm file
   *
   * Uses MLX to load the texture image and retrieve pixel data address.
-  * Validates texture dimensions (must be TEXTURE_WIDTH x TEXTURE_HEIGHT).
+  * Textures can be any size; the size is kept in the structure and
+  * every sampler works from it.
   * Fills the provided t_texture structure with all necessary data.
   * Cleans up texture image on validation failure to prevent memory leaks.
   *
@@ -34,13 +35,6 @@ static int	load_texture(t_game *game, t_texture *texture, char *path)
 		print_errors(TEXTURE_LOAD, NULL, NULL);
 		return (EXIT_FAILURE);
 	}
-	if (texture->width != TEXTURE_WIDTH || texture->height != TEXTURE_HEIGHT)
-	{
-		mlx_destroy_image(game->mlx, texture->img);
-		texture->img = NULL;
-		print_errors(TEXTURE_DIMENSION, NULL, NULL);
-		return (EXIT_FAILURE);
-	}
 	texture->addr = mlx_get_data_addr(texture->img, &texture->bpp,
 			&texture->line_len, &texture->endian);
 	if (!texture->addr)
@@ -54,9 +48,36 @@ static int	load_texture(t_game *game, t_texture *texture, char *path)
 }
 
 /**
-  * @brief Loads all 4 wall textures (NO, SO, WE, EA)
+  * @brief Destroys the MLX images once their pixels are in the atlas
+  *
+  * @param game Pointer to game structure
+*/
+static void	release_source_images(t_game *game)
+{
+	int	i;
+
+	i = 0;
+	while (i < HEADER_SIZE)
+	{
+		if (game->textures[i].img)
+			mlx_destroy_image(game->mlx, game->textures[i].img);
+		game->textures[i].img = NULL;
+		game->textures[i].addr = NULL;
+		i++;
+	}
+}
+
+/**
+  * @brief Loads the 4 wall textures and the optional floor/ceiling textures
   *
   * Iterates through tex_paths array and loads each texture using load_texture()
+  * Floor and ceiling entries are only set when their header used an .xpm
+  * path instead of an RGB color, and are skipped otherwise.
+  * All loaded textures are then packed with their mip chains into the
+  * texture atlas, and the MLX images are released. With --palette, wall
+  * textures of up to PALETTE_SIZE colors are stored as 8-bit indices;
+  * floor casting always reads 32-bit texels. With --fog, the fog tables
+  * are built first, since fogged palettes are derived from them.
   * Cleans up already-loaded textures on failure to prevent partial state.
   *
   * @param game Pointer to game structure
@@ -67,9 +88,11 @@ int	init_textures(t_game *game)
 	int	i;
 
 	i = 0;
-	while (i < TEX_SIZE)
+	while (i < HEADER_SIZE)
 	{
-		if (load_texture(game, &game->textures[i], game->map.tex_paths[i])
+		game->textures[i].palettise = (game->palette_mode && i < ID_FLOOR);
+		if (game->map.tex_paths[i]
+			&& load_texture(game, &game->textures[i], game->map.tex_paths[i])
 			!= EXIT_SUCCESS)
 		{
 			cleanup_textures(game);
@@ -77,5 +100,14 @@ int	init_textures(t_game *game)
 		}
 		i++;
 	}
+	if (game->shade.fog_dist > 0)
+		build_shade_tables(&game->shade);
+	if (build_texture_atlas(&game->atlas, game->textures, HEADER_SIZE,
+			&game->shade) != EXIT_SUCCESS)
+	{
+		cleanup_textures(game);
+		return (EXIT_FAILURE);
+	}
+	release_source_images(game);
 	return (EXIT_SUCCESS);
 }
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_args.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:55:15 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:36:10 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Sets the mode enabled by a flag that takes no value
+ *
+ * @param flag Command line argument
+ * @param game Pointer to game structure receiving the setting
+ * @return true if flag is a known switch, false otherwise
+ */
+static bool	parse_switch(const char *flag, t_game *game)
+{
+	if (ft_strcmp(flag, PALETTE_FLAG) == 0)
+		game->palette_mode = true;
+	else if (ft_strcmp(flag, SPANS_FLAG) == 0)
+		game->span_mode = true;
+	else if (ft_strcmp(flag, BILINEAR_FLAG) == 0)
+		game->bilinear = true;
+	else if (ft_strcmp(flag, QUIET_FLAG) == 0)
+		game->verbosity = VERBOSITY_QUIET;
+	else if (ft_strcmp(flag, VERBOSE_FLAG) == 0)
+		game->verbosity = VERBOSITY_MAP;
+	else
+		return (false);
+	return (true);
+}
+
+/**
+ * @brief Parses the optional flag at argv[*i] and moves past it
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param i Index of the flag, advanced past the flag and its value
+ * @param game Pointer to game structure receiving the setting
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on an unknown flag, a
+ *         missing value or a bad value
+ */
+static int	parse_option(int argc, char **argv, int *i, t_game *game)
+{
+	if (parse_switch(argv[*i], game))
+	{
+		(*i)++;
+		return (EXIT_SUCCESS);
+	}
+	if (*i + 1 >= argc)
+		return (print_errors(ARG_USAGE, ARG_USAGE_OPTIONS, ARG_USAGE_ISA),
+			EXIT_FAILURE);
+	*i += 2;
+	if (ft_strcmp(argv[*i - 2], RES_FLAG) == 0)
+		return (parse_resolution(argv[*i - 1], game));
+	if (ft_strcmp(argv[*i - 2], FOG_FLAG) == 0)
+		return (parse_distance(argv[*i - 1], &game->shade.fog_dist,
+				ARG_FOG_FORMAT));
+	if (ft_strcmp(argv[*i - 2], MAX_DIST_FLAG) == 0)
+		return (parse_distance(argv[*i - 1], &game->max_ray_dist,
+				ARG_MAX_DIST_FORMAT));
+	if (ft_strcmp(argv[*i - 2], AA_FLAG) == 0)
+		return (parse_samples(argv[*i - 1], &game->aa_samples));
+	if (ft_strcmp(argv[*i - 2], ISA_FLAG) == 0)
+		return (parse_isa(argv[*i - 1]));
+	return (print_errors(ARG_USAGE, ARG_USAGE_OPTIONS, ARG_USAGE_ISA),
+		EXIT_FAILURE);
+}
+
+/**
+ * @brief Parses the command line: map path followed by optional flags
+ *
+ * Expected form:
+ *   ./cub3D <map.cub> [--res WIDTHxHEIGHT] [--palette] [--spans]
+ *           [--fog DIST] [--max-dist DIST] [--aa SAMPLES] [--bilinear]
+ *           [--force-isa scalar|sse2|avx2] [--quiet|--verbose]
+ * The map path itself is validated separately by validate_argument().
+ * Re-centers the mouse tracking position on the chosen window size.
+ *
+ * @param argc Argument count
+ * @param argv Argument vector (argv[1] = path to .cub file)
+ * @param game Pointer to game structure (already initialized)
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on bad usage
+ */
+int	parse_args(int argc, char **argv, t_game *game)
+{
+	int	i;
+
+	if (argc < 2)
+		return (print_errors(ARG_USAGE, ARG_USAGE_OPTIONS, ARG_USAGE_ISA),
+			EXIT_FAILURE);
+	i = 2;
+	while (i < argc)
+	{
+		if (parse_option(argc, argv, &i, game) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+	}
+	game->last_mouse_x = game->win_w / 2;
+	game->last_mouse_y = game->win_h / 2;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_args_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:25:50 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:41:56 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Parses an unsigned decimal dimension and advances the cursor
+ *
+ * @param str Address of the cursor into the argument string
+ * @param out Pointer to store the parsed value
+ * @return EXIT_SUCCESS if at least one digit was read and the value fits
+ *         in an int, EXIT_FAILURE otherwise
+ */
+static int	parse_dimension(const char **str, int *out)
+{
+	long	value;
+
+	if (!ft_isdigit(**str))
+		return (EXIT_FAILURE);
+	value = 0;
+	while (ft_isdigit(**str))
+	{
+		value = value * 10 + (**str - '0');
+		if (value > INT_MAX)
+			return (EXIT_FAILURE);
+		(*str)++;
+	}
+	*out = (int)value;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Parses a "WIDTHxHEIGHT" resolution argument
+ *
+ * Only checks the format here. Bounds against the minimum size and the
+ * screen are checked later by validate_window_size(), once the MLX
+ * connection exists.
+ *
+ * @param arg Argument string, e.g. "1280x720"
+ * @param game Pointer to game structure receiving win_w and win_h
+ * @return EXIT_SUCCESS if the format is valid, EXIT_FAILURE otherwise
+ */
+int	parse_resolution(const char *arg, t_game *game)
+{
+	if (parse_dimension(&arg, &game->win_w) == EXIT_SUCCESS && *arg == 'x')
+	{
+		arg++;
+		if (parse_dimension(&arg, &game->win_h) == EXIT_SUCCESS
+			&& *arg == '\0')
+			return (EXIT_SUCCESS);
+	}
+	print_errors(ARG_RES_FORMAT, NULL, NULL);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Parses a distance in map cells, e.g. the "12" of "--fog 12"
+ *
+ * @param arg Argument string
+ * @param out Pointer to store the distance
+ * @param error Message printed if the value is invalid
+ * @return EXIT_SUCCESS if the distance is a positive integer,
+ *         EXIT_FAILURE otherwise
+ */
+int	parse_distance(const char *arg, double *out, char *error)
+{
+	int	dist;
+
+	if (parse_dimension(&arg, &dist) != EXIT_SUCCESS || *arg != '\0'
+		|| dist == 0)
+	{
+		print_errors(error, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	*out = dist;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Parses the sub-column ray count of "--aa N"
+ *
+ * @param arg Argument string
+ * @param out Pointer to store the sample count
+ * @return EXIT_SUCCESS if the count is 2 to AA_MAX_SAMPLES,
+ *         EXIT_FAILURE otherwise
+ */
+int	parse_samples(const char *arg, int *out)
+{
+	int	samples;
+
+	if (parse_dimension(&arg, &samples) != EXIT_SUCCESS || *arg != '\0'
+		|| samples < 2 || samples > AA_MAX_SAMPLES)
+	{
+		print_errors(ARG_AA_FORMAT, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	*out = samples;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Forces the render kernels of "--force-isa NAME"
+ *
+ * Lets every kernel variant be benchmarked and tested on the same
+ * machine.
+ *
+ * @param arg Instruction set name, see isa_name()
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE if the name is unknown or
+ *         this CPU cannot run that instruction set
+ */
+int	parse_isa(const char *arg)
+{
+	t_isa	isa;
+
+	isa = ISA_SCALAR;
+	while (isa < ISA_COUNT && ft_strcmp(arg, isa_name(isa)) != 0)
+		isa++;
+	if (isa == ISA_COUNT)
+	{
+		print_errors(ARG_ISA_FORMAT, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	if (!isa_supported(isa))
+	{
+		print_errors(ISA_UNSUPPORTED, (char *)arg, NULL);
+		return (EXIT_FAILURE);
+	}
+	kernel_table(isa, kernels());
+	return (EXIT_SUCCESS);
+}
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:56:37 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 20:19:37 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,8 @@
  * @brief Program entry point for Cub3D
  *
  * Orchestrates the complete initialization sequence:
- *   1. Validates command-line arguments
- *   2. Initializes game state structure
+ *   1. Initializes game state structure
+ *   2. Parses and validates command-line arguments
  *   3. Parses and validates the .cub file
  *   4. Sets up graphics (MLX connection, window, image buffer)
  *   5. Loads wall textures
@@ -25,9 +25,12 @@
  *   7. Enters the main rendering loop
  *
  * Exits immediately if any initialization step fails.
+ * With --check as first argument, only validates the given maps instead
+ * (see run_check()), without any graphics.
  *
- * @param argc Argument count (must be 2)
- * @param argv Argument vector (argv[1] = path to .cub file)
+ * @param argc Argument count (at least 2)
+ * @param argv Argument vector (argv[1] = path to .cub file, then optional
+ *             flags such as --res WIDTHxHEIGHT)
  * @return EXIT_SUCCESS on normal exit, EXIT_FAILURE on error
  *
  * @note The cleanup_exit() call at the end is never reached during normal
@@ -37,12 +40,11 @@ int	main(int argc, char **argv)
 {
 	t_game	game;
 
-	if (argc != 2)
-	{
-		print_errors(ARG_USAGE, NULL, NULL);
-		return (EXIT_FAILURE);
-	}
+	if (argc >= 2 && ft_strcmp(argv[1], CHECK_FLAG) == 0)
+		return (run_check(argc, argv));
 	init_t_game(&game);
+	if (parse_args(argc, argv, &game) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
 	if (validate_argument(argv[1]) != EXIT_SUCCESS)
 		cleanup_exit(&game, EXIT_FAILURE);
 	if (parse_and_validate_cub(argv[1], &game) != EXIT_SUCCESS)
@@ -51,8 +53,7 @@ int	main(int argc, char **argv)
 		cleanup_exit(&game, EXIT_FAILURE);
 	if (init_textures(&game) != EXIT_SUCCESS)
 		cleanup_exit(&game, EXIT_FAILURE);
-	print_ascii_art_hello();
-	print_map_grid(&game.map);
+	print_startup_info(&game);
 	setup_hooks(&game);
 	mlx_loop_hook(game.mlx, game_loop, &game);
 	mlx_loop(game.mlx);
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:58:06 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 13:58:09 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:03 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,21 +31,24 @@ static bool	is_header_line(const char *line)
 /**
  * @brief Count consecutive header lines at the start of a file
  *
- * Stops counting on the first non-header, non-empty line.
+ * Stops counting on the first non-header, non-empty line. bytes gets
+ * the room their values take in the map's string block: each value is
+ * shorter than its line, plus up to ARENA_ALIGN bytes of alignment.
  */
-static int	count_header_lines(int fd)
+static int	count_header_lines(t_gnl *gnl, size_t *bytes)
 {
 	char	*line;
 	int		count;
 
 	count = 0;
-	line = get_next_line(fd);
+	*bytes = 0;
+	line = get_next_line_r(gnl);
 	while (line)
 	{
 		if (line_is_empty(line))
 		{
 			free(line);
-			line = get_next_line(fd);
+			line = get_next_line_r(gnl);
 			continue ;
 		}
 		if (!is_header_line(line))
@@ -54,8 +57,9 @@ static int	count_header_lines(int fd)
 			break ;
 		}
 		count++;
+		*bytes += ft_strlen(line) + ARENA_ALIGN;
 		free(line);
-		line = get_next_line(fd);
+		line = get_next_line_r(gnl);
 	}
 	return (count);
 }
@@ -63,19 +67,29 @@ static int	count_header_lines(int fd)
 /**
  * @brief Validate the number of headers in a .cub file
  *
- * Ensures the file contains exactly HEADER_SIZE identifiers.
+ * Ensures the file contains exactly HEADER_SIZE identifiers. The same
+ * read gives the size of the string block for their values, so the
+ * block is as large as the paths actually given, not HEADER_SIZE times
+ * PATH_MAX, without reading the header again.
+ *
+ * @param path Path to the .cub file
+ * @param bytes Gets the size of the string block; may be NULL
+ * @return EXIT_SUCCESS if the count is right, EXIT_FAILURE otherwise
  */
-int	check_header_count(const char *path)
+int	check_header_count(const char *path, size_t *bytes)
 {
-	int		fd;
+	t_gnl	gnl;
 	int		count;
+	size_t	size;
 
-	fd = open_cub_file(path);
-	if (fd < 0)
+	gnl = (t_gnl){.fd = open_cub_file(path)};
+	if (gnl.fd < 0)
 		return (EXIT_FAILURE);
-	count = count_header_lines(fd);
-	gnl_clear_fd(fd);
-	close(fd);
+	count = count_header_lines(&gnl, &size);
+	gnl_release(&gnl);
+	close(gnl.fd);
+	if (bytes)
+		*bytes = size;
 	if (count < HEADER_SIZE)
 	{
 		print_errors(HEADER_MISSING, NULL, NULL);
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:58:21 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 13:58:23 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:03:27 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -101,14 +101,14 @@ static bool	check_file_access(const char *filename)
 	fd = open(filename, O_RDONLY);
 	if (fd < 0)
 	{
-		perror("Error\nopen");
+		print_errors(FILE_OPEN, strerror(errno), NULL);
 		return (false);
 	}
 	bytes_read = read(fd, buffer, 1);
 	close(fd);
 	if (bytes_read < 0)
 	{
-		perror("Error\nread");
+		print_errors(FILE_READ, strerror(errno), NULL);
 		return (false);
 	}
 	return (true);
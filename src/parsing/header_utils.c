@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:58:41 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 13:58:46 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:03 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,13 +18,13 @@
  * increments the line counter.
  *
  * @param line Pointer to the current line buffer.
- * @param fd   File descriptor to read from.
+ * @param gnl  Reader of the file.
  * @param i    Pointer to current line index (will be incremented).
  */
-void	next_line(char **line, int fd, int *i)
+void	next_line(char **line, t_gnl *gnl, int *i)
 {
 	free(*line);
-	*line = get_next_line(fd);
+	*line = get_next_line_r(gnl);
 	(*i)++;
 }
 
@@ -49,3 +49,59 @@ bool	line_is_empty(char *line)
 	}
 	return (true);
 }
+
+/**
+ * @brief Check if a header value is a path to an .xpm file.
+ *
+ * Used by the F and C headers, which accept either an "R,G,B" color or
+ * a texture path. Trailing whitespace (including the newline) is ignored.
+ * An RGB value can never end with ".xpm", so RGB error reporting is
+ * unchanged.
+ *
+ * @param value Header value, after the identifier.
+ * @return true if the value ends with ".xpm", false otherwise.
+ */
+bool	value_is_xpm_path(const char *value)
+{
+	size_t	len;
+	size_t	ext_len;
+
+	len = ft_strlen(value);
+	while (len > 0 && ft_isspace(value[len - 1]))
+		len--;
+	ext_len = ft_strlen(XPM_EXTENSION);
+	if (len <= ext_len)
+		return (false);
+	return (ft_strncmp(value + len - ext_len, XPM_EXTENSION, ext_len) == 0);
+}
+
+/**
+ * @brief Moves map->strings to a larger block, with room for size more
+ *        bytes.
+ *
+ * The texture paths already stored point into the block, so they are
+ * moved with it; nothing else may point into it.
+ *
+ * @param map Map whose string block grows.
+ * @param size Bytes needed past the ones used.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure (block kept).
+ */
+int	grow_header_strings(t_map *map, size_t size)
+{
+	t_arena	grown;
+	int		i;
+
+	if (arena_init(&grown, 2 * map->strings.cap + size + ARENA_ALIGN)
+		!= EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	ft_memcpy(grown.base, map->strings.base, map->strings.used);
+	grown.used = map->strings.used;
+	i = -1;
+	while (++i < HEADER_SIZE)
+		if (map->tex_paths[i])
+			map->tex_paths[i] = grown.base
+				+ (map->tex_paths[i] - map->strings.base);
+	arena_free(&map->strings);
+	map->strings = grown;
+	return (EXIT_SUCCESS);
+}
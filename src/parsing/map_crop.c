@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_crop.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:14:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Keeps width cells of a row from column x0, unmarking them.
+ *
+ * @param row Grid row, at least x0 + width cells long.
+ * @param x0 First column kept.
+ * @param width Number of columns kept.
+ */
+static void	crop_row(char *row, int x0, int width)
+{
+	int	x;
+
+	x = 0;
+	while (x < width)
+	{
+		row[x] = row[x0 + x];
+		if (row[x] == REACH_MARK)
+			row[x] = '0';
+		x++;
+	}
+	row[width] = '\0';
+}
+
+/**
+ * @brief Crops the grid, in place, to a bounding box grown by one cell.
+ *
+ * The extra cell on each side holds the walls around the reachable
+ * area: validation guarantees every open cell has four neighbours in
+ * the grid. Rows outside the box stay unused in the grid block.
+ *
+ * @param map Map to crop.
+ * @param box Bounding box of the reachable cells.
+ */
+static void	crop_grid(t_map *map, const int box[4])
+{
+	int	width;
+	int	height;
+	int	y;
+
+	width = box[2] - box[0] + 3;
+	height = box[3] - box[1] + 3;
+	y = 0;
+	while (y < height)
+	{
+		map->grid[y] = map->grid[y + box[1] - 1];
+		crop_row(map->grid[y], box[0] - 1, width);
+		y++;
+	}
+	map->width = width;
+	map->height = height;
+}
+
+/**
+ * @brief Crops a validated map to the area the player can reach.
+ *
+ * Flood fills from the spawn (flood_map()), then crops the grid to the
+ * walls around the reachable cells and moves the player to match. Rays
+ * and moves never leave that area, so the game behaves the same on a
+ * smaller grid. Cells left out (padding, unreachable rooms) are only
+ * counted in map->stats.
+ *
+ * @param game Game with a validated map and its player.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure.
+ */
+int	crop_to_reachable(t_game *game)
+{
+	t_map	*map;
+	int		box[4];
+
+	map = &game->map;
+	map->stats.full_width = map->width;
+	map->stats.full_height = map->height;
+	if (flood_map(map, (int)game->player.pos_x, (int)game->player.pos_y,
+			box) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	crop_grid(map, box);
+	map->stats.crop_x = box[0] - 1;
+	map->stats.crop_y = box[1] - 1;
+	game->player.pos_x -= map->stats.crop_x;
+	game->player.pos_y -= map->stats.crop_y;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Prints the map statistics, for map authors.
+ *
+ * @param map Map cropped by crop_to_reachable().
+ */
+void	print_map_stats(const t_map *map)
+{
+	t_outbuf	out;
+
+	ft_outbuf_init(&out, STDOUT_FILENO);
+	ft_outbuf_putfield(&out, MAG "Reachable cells: ", map->stats.reachable);
+	ft_outbuf_putfield(&out, " of ", map->stats.open_cells);
+	ft_outbuf_putfield(&out, " open cells, in ", map->stats.components);
+	ft_outbuf_putfield(&out, " connected area(s)\n" RESET MAG
+		"Grid cropped from ", map->stats.full_width);
+	ft_outbuf_putfield(&out, " x ", map->stats.full_height);
+	ft_outbuf_putfield(&out, " to ", map->width);
+	ft_outbuf_putfield(&out, " x ", map->height);
+	ft_outbuf_putfield(&out, " at (", map->stats.crop_x);
+	ft_outbuf_putfield(&out, ", ", map->stats.crop_y);
+	ft_outbuf_putstr(&out, ")\n" RESET);
+	ft_outbuf_flush(&out);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_load.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:09:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:48:59 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Parses a .cub file and fills the t_map structure.
+ *
+ * It reads the .cub file from map->map_start_line and loads the grid,
+ * each row padded to the map width.
+ *
+ * @param path Path to the .cub file.
+ * @param map Pointer to t_map structure to fill.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on failure.
+ *
+ * @note **No validation of the map contents is performed.** See
+ *       load_valid_map() for loading and validating in one pass.
+ */
+int	parse_map(const char *path, t_map *map)
+{
+	return (load_map_grid(path, map, NULL));
+}
+
+/**
+ * @brief Loads the map grid, validating it and finding the player while
+ *        the rows are read.
+ *
+ * Replaces parse_map(), init_player() and check_valid_map() in a single
+ * pass over the rows: the streaming validator fails at the first bad row,
+ * without loading the rest of the file. Tall maps are only streamed for
+ * their first MAP_BAND_MIN_ROWS * 2 rows; past that, each row is scanned
+ * (characters, player) as it is read, and the enclosure of the rest is
+ * checked once loaded, in bands checked concurrently (check_map_rows()).
+ * Either way the error reported is the one validate_map_file() reports.
+ *
+ * @param path Path to the .cub file.
+ * @param game Game whose map (map_start_line set) and player are filled.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on error (grid freed).
+ */
+int	load_valid_map(const char *path, t_game *game)
+{
+	t_map_stream	st;
+
+	map_stream_init(&st, MAX_MAP_W, MAX_MAP_H, MAP_TOO_LARGE);
+	st.check_rows = 2 * MAP_BAND_MIN_ROWS;
+	if (load_map_grid(path, &game->map, &st) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	game->map.grid[st.player_y][st.player_x] = '0';
+	set_player_position(&game->player, st.player_x, st.player_y,
+		st.player_dir);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Feeds the map rows to a stream.
+ *
+ * @param rd Reader of the .cub file, at the first map row.
+ * @param st Streaming validator.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on the first error.
+ */
+static int	stream_map_rows(t_row_reader *rd, t_map_stream *st)
+{
+	const char	*row;
+	int			len;
+
+	row = read_map_row(rd, &len);
+	while (row)
+	{
+		if (map_stream_push(st, row, len) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+		row = read_map_row(rd, &len);
+	}
+	if (rd->error)
+		return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+	return (map_stream_finish(st));
+}
+
+/**
+ * @brief Validates the map of a .cub file without loading its grid.
+ *
+ * Same checks, size cap and errors as load_valid_map(), but only three
+ * rows are in memory at any time (the t_row_reader buffers). Sets the map
+ * width and height and the player; map->grid stays NULL.
+ *
+ * @param path Path to the .cub file.
+ * @param game Game whose map (map_start_line set) and player are filled.
+ * @return EXIT_SUCCESS if the map is valid, EXIT_FAILURE otherwise.
+ */
+int	validate_map_file(const char *path, t_game *game)
+{
+	t_map_stream	st;
+	t_row_reader	rd;
+	int				status;
+
+	if (open_map_rows(&rd, path, game->map.map_start_line) != EXIT_SUCCESS)
+		return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+	map_stream_init(&st, MAX_MAP_W, MAX_MAP_H, MAP_TOO_LARGE);
+	status = stream_map_rows(&rd, &st);
+	close_map_rows(&rd);
+	game->map.width = st.width;
+	game->map.height = st.height;
+	if (status == EXIT_SUCCESS)
+		set_player_position(&game->player, st.player_x, st.player_y,
+			st.player_dir);
+	return (status);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_reach.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:14:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:14:13 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Marks an open cell as seen and queues it.
+ *
+ * Does nothing for walls, spaces, cells already seen and positions
+ * outside the grid.
+ *
+ * @param map Map being filled; seen cells become REACH_MARK.
+ * @param fl Flood fill state.
+ * @param x Column of the cell.
+ * @param y Row of the cell.
+ */
+static void	flood_push(t_map *map, t_flood *fl, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height
+		|| map->grid[y][x] != '0')
+		return ;
+	map->grid[y][x] = REACH_MARK;
+	fl->stack[fl->len++] = y * map->width + x;
+}
+
+/**
+ * @brief Grows the bounding box [min_x, min_y, max_x, max_y] to a cell.
+ */
+static void	grow_box(int box[4], int x, int y)
+{
+	if (x < box[0])
+		box[0] = x;
+	if (y < box[1])
+		box[1] = y;
+	if (x > box[2])
+		box[2] = x;
+	if (y > box[3])
+		box[3] = y;
+}
+
+/**
+ * @brief Marks the open cells connected to (x, y), moving up, down,
+ *        left or right, as the player does.
+ *
+ * Each cell is queued once at most, so the stack never holds more than
+ * width * height cells.
+ *
+ * @param map Map being filled.
+ * @param fl Flood fill state; fl->box receives the cells' bounding box.
+ * @param x Column of the first cell, open and not yet seen.
+ * @param y Row of the first cell.
+ * @return Number of cells marked.
+ */
+static int	flood_fill(t_map *map, t_flood *fl, int x, int y)
+{
+	int	count;
+	int	cell;
+
+	fl->len = 0;
+	fl->box[0] = x;
+	fl->box[1] = y;
+	fl->box[2] = x;
+	fl->box[3] = y;
+	flood_push(map, fl, x, y);
+	count = 0;
+	while (fl->len > 0)
+	{
+		cell = fl->stack[--fl->len];
+		x = cell % map->width;
+		y = cell / map->width;
+		grow_box(fl->box, x, y);
+		flood_push(map, fl, x + 1, y);
+		flood_push(map, fl, x - 1, y);
+		flood_push(map, fl, x, y + 1);
+		flood_push(map, fl, x, y - 1);
+		count++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Finds the cells reachable from the spawn and counts the
+ *        connected open areas of a validated map.
+ *
+ * Fills map->stats (open_cells, reachable, components). Every open cell
+ * is left marked as REACH_MARK, see crop_to_reachable().
+ *
+ * @param map Validated map, the spawn cell already replaced by '0'.
+ * @param spawn_x Column of the player spawn.
+ * @param spawn_y Row of the player spawn.
+ * @param box Receives the bounding box of the reachable cells, as
+ *            [min_x, min_y, max_x, max_y].
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure.
+ */
+int	flood_map(t_map *map, int spawn_x, int spawn_y, int box[4])
+{
+	t_flood	fl;
+	int		i;
+
+	fl.stack = malloc(sizeof(int) * map->width * map->height);
+	if (!fl.stack)
+		return (print_errors(MAP_REACH, NULL, NULL), EXIT_FAILURE);
+	map->stats.reachable = flood_fill(map, &fl, spawn_x, spawn_y);
+	ft_memcpy(box, fl.box, sizeof(fl.box));
+	map->stats.open_cells = map->stats.reachable;
+	map->stats.components = 1;
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		if (map->grid[i / map->width][i % map->width] == '0')
+		{
+			map->stats.open_cells += flood_fill(map, &fl,
+					i % map->width, i / map->width);
+			map->stats.components++;
+		}
+		i++;
+	}
+	free(fl.stack);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_rows.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:21:14 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:21:14 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Grows a row buffer, keeping what it holds
+ *
+ * @param rd Row reader
+ * @param slot Row buffer, 0 to 2
+ * @param need Bytes the buffer must hold
+ * @return EXIT_SUCCESS, or EXIT_FAILURE (rd->error set)
+ */
+static int	grow_row(t_row_reader *rd, int slot, long need)
+{
+	char	*grown;
+	long	cap;
+
+	if (need <= rd->caps[slot])
+		return (EXIT_SUCCESS);
+	cap = rd->caps[slot] * 2L + 64;
+	while (cap < need)
+		cap *= 2;
+	grown = NULL;
+	if (cap <= INT_MAX)
+		grown = malloc(cap);
+	if (!grown)
+		return (rd->error = true, EXIT_FAILURE);
+	ft_memcpy(grown, rd->rows[slot], rd->caps[slot]);
+	free(rd->rows[slot]);
+	rd->rows[slot] = grown;
+	rd->caps[slot] = cap;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Reads the next chunk of the file
+ *
+ * @param rd Row reader
+ * @return Number of bytes read, 0 at the end of the file or on error
+ *         (rd->error set)
+ */
+static int	read_chunk(t_row_reader *rd)
+{
+	ssize_t	n;
+
+	n = read(rd->fd, rd->chunk, ROW_CHUNK_SIZE);
+	rd->pos = 0;
+	rd->len = 0;
+	if (n < 0)
+		rd->error = true;
+	else
+		rd->len = n;
+	return (rd->len);
+}
+
+/**
+ * @brief Opens a .cub file and skips the rows before the map
+ *
+ * @param rd Row reader to set up
+ * @param path Path to the .cub file
+ * @param start Index of the first map row (map_start_line)
+ * @return EXIT_SUCCESS, or EXIT_FAILURE (nothing left to close)
+ */
+int	open_map_rows(t_row_reader *rd, const char *path, int start)
+{
+	int	len;
+
+	ft_bzero(rd, sizeof(*rd));
+	rd->fd = open_cub_file(path);
+	if (rd->fd < 0)
+		return (EXIT_FAILURE);
+	while (rd->count < start && read_map_row(rd, &len))
+		;
+	if (rd->error)
+		return (close_map_rows(rd), EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Reads the next row, without its newline
+ *
+ * The file is read one chunk at a time, and the row copied into one of
+ * three buffers used in turn: a row stays valid for the next two calls,
+ * as map_stream_push() needs, and no row is allocated on its own.
+ *
+ * @param rd Row reader set up by open_map_rows()
+ * @param len Receives the row length
+ * @return The row, or NULL at the end of the file or on error (rd->error)
+ */
+const char	*read_map_row(t_row_reader *rd, int *len)
+{
+	char	*end;
+	int		slot;
+	int		take;
+
+	slot = rd->count % 3;
+	*len = 0;
+	end = NULL;
+	while (!end && (rd->pos < rd->len || read_chunk(rd) > 0))
+	{
+		end = ft_memchr(rd->chunk + rd->pos, '\n', rd->len - rd->pos);
+		take = rd->len - rd->pos;
+		if (end)
+			take = end - (rd->chunk + rd->pos);
+		if (grow_row(rd, slot, (long)*len + take + 1) != EXIT_SUCCESS)
+			return (NULL);
+		ft_memcpy(rd->rows[slot] + *len, rd->chunk + rd->pos, take);
+		*len += take;
+		rd->pos += take + (end != NULL);
+	}
+	if (rd->error || (!end && *len == 0))
+		return (NULL);
+	rd->rows[slot][*len] = '\0';
+	rd->count++;
+	return (rd->rows[slot]);
+}
+
+/**
+ * @brief Frees the row buffers and closes the file
+ *
+ * @param rd Row reader; safe to call twice
+ */
+void	close_map_rows(t_row_reader *rd)
+{
+	int	i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		free(rd->rows[i]);
+		rd->rows[i] = NULL;
+		rd->caps[i] = 0;
+	}
+	if (rd->fd >= 0)
+		close(rd->fd);
+	rd->fd = -1;
+}
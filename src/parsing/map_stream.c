@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_stream.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:08:48 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:48:59 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Starts a stream with its size cap
+ *
+ * The cap belongs to the caller; both loaders pass the game's
+ * (MAX_MAP_W x MAX_MAP_H), so --check never passes a map the game
+ * rejects. Every row is validated; a caller holding the grid may lower
+ * st->check_rows and validate the rows past it itself.
+ *
+ * @param st Stream state to reset
+ * @param max_width Longest row accepted
+ * @param max_height Most rows accepted
+ * @param too_large Error printed past the cap
+ */
+void	map_stream_init(t_map_stream *st, int max_width, int max_height,
+		char *too_large)
+{
+	ft_bzero(st, sizeof(*st));
+	st->max_width = max_width;
+	st->max_height = max_height;
+	st->check_rows = max_height;
+	st->too_large = too_large;
+}
+
+/**
+ * @brief Checks the characters of a new row and looks for the player
+ *
+ * Runs as soon as the row is read, so a bad character or a second player
+ * fails on its own row, before the rows above are checked against it.
+ *
+ * @param st Stream state
+ * @param row New row, without its newline
+ * @param len Row length
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	scan_row(t_map_stream *st, const char *row, int len)
+{
+	int	x;
+
+	if (len > st->max_width || st->height >= st->max_height)
+		return (print_errors(st->too_large, NULL, NULL), EXIT_FAILURE);
+	x = 0;
+	while (x < len)
+	{
+		if (!row[x] || !ft_strchr(PLAYER, row[x]))
+		{
+			if (row[x] != '0' && row[x] != '1' && row[x] != ' ')
+				return (print_errors(MAP_CHAR, NULL, NULL), EXIT_FAILURE);
+		}
+		else if (st->player_dir)
+			return (print_errors(PLAYER_MULTI, NULL, NULL), EXIT_FAILURE);
+		else
+		{
+			st->player_x = x;
+			st->player_y = st->height;
+			st->player_dir = row[x];
+		}
+		x++;
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Slides the window one row down
+ *
+ * @param st Stream state
+ * @param row Row entering the window, NULL past the last row
+ * @param len Row length
+ */
+static void	shift_window(t_map_stream *st, const char *row, int len)
+{
+	st->rows[0] = st->rows[1];
+	st->lens[0] = st->lens[1];
+	st->rows[1] = st->rows[2];
+	st->lens[1] = st->lens[2];
+	st->rows[2] = row;
+	st->lens[2] = len;
+}
+
+/**
+ * @brief Feeds the next map row to the streaming validator
+ *
+ * The row is scanned at once, then the row above it, which now has both
+ * neighbors, is validated if it is one of the first st->check_rows. Only
+ * the last three rows are looked at, so a map fails at its first bad
+ * row, and the caller only has to keep those rows alive. st must start
+ * from map_stream_init().
+ *
+ * @param st Stream state
+ * @param row New row; must stay valid for the next two calls
+ * @param len Row length, without the newline
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+int	map_stream_push(t_map_stream *st, const char *row, int len)
+{
+	if (scan_row(st, row, len) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	shift_window(st, row, len);
+	st->height++;
+	st->width = max_int(st->width, len);
+	if (st->rows[1] && st->height - 2 < st->check_rows)
+		return (check_map_row(st));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Validates the last row and checks that a player was found
+ *
+ * The last row is left to the caller too when it is past st->check_rows.
+ *
+ * @param st Stream state, after the last map_stream_push()
+ * @return EXIT_SUCCESS if the whole map is valid, EXIT_FAILURE otherwise
+ */
+int	map_stream_finish(t_map_stream *st)
+{
+	shift_window(st, NULL, 0);
+	if (st->rows[1] && st->height - 1 < st->check_rows
+		&& check_map_row(st) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	if (!st->player_dir)
+	{
+		print_errors(PLAYER_NONE, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
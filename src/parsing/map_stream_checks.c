@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_stream_checks.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:08:48 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:08:48 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Tells if a map character is walkable ('0' or the player)
+ */
+static bool	is_open(char c)
+{
+	return (c == '0' || (c && ft_strchr(PLAYER, c)));
+}
+
+/**
+ * @brief Returns a cell of the stream window, as in the padded grid
+ *
+ * @param st Stream window
+ * @param row 0 (above), 1 (under check) or 2 (below)
+ * @param x Column
+ * @return The cell, or ' ' past the end of the row (grid padding)
+ */
+static char	cell_at(const t_map_stream *st, int row, int x)
+{
+	if (x < 0 || x >= st->lens[row])
+		return (' ');
+	return (st->rows[row][x]);
+}
+
+/**
+ * @brief Check that a walkable cell is only adjacent to '0' or '1'
+ *
+ * Same rule as check_zero_adjacent(), on the stream window. The edge of
+ * the map is the end of the row itself: the final width is not known
+ * yet when the row is checked.
+ *
+ * @param st Stream window
+ * @param x Column of the cell, in the middle row
+ * @return EXIT_SUCCESS if all neighbors are valid, EXIT_FAILURE otherwise
+ */
+static int	check_open_cell(const t_map_stream *st, int x)
+{
+	const int	dir_y[ADJACENT_DIR_COUNT] = {1, -1, 0, 0};
+	const int	dir_x[ADJACENT_DIR_COUNT] = {0, 0, 1, -1};
+	int			i;
+	int			row;
+	int			nx;
+
+	i = 0;
+	while (i < ADJACENT_DIR_COUNT)
+	{
+		row = 1 + dir_y[i];
+		nx = x + dir_x[i];
+		if (!st->rows[row] || nx < 0 || (row == 1 && nx >= st->lens[1]))
+			return (print_errors(MAP_ZERO_BORDER, NULL, NULL), EXIT_FAILURE);
+		if (cell_at(st, row, nx) != '1' && !is_open(cell_at(st, row, nx)))
+			return (print_errors(MAP_ZERO_INVALID, NULL, NULL),
+				EXIT_FAILURE);
+		i++;
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Check that a space cell (padding included) touches no walkable
+ *        cell, as check_space_adjacent()
+ *
+ * @param st Stream window
+ * @param x Column of the cell, in the middle row
+ * @return EXIT_SUCCESS if all neighbors are valid, EXIT_FAILURE otherwise
+ */
+static int	check_space_cell(const t_map_stream *st, int x)
+{
+	if (is_open(cell_at(st, 2, x)) || is_open(cell_at(st, 0, x))
+		|| is_open(cell_at(st, 1, x + 1)) || is_open(cell_at(st, 1, x - 1)))
+	{
+		print_errors(MAP_SPACE, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Validates the middle row of the stream window
+ *
+ * Cells are checked left to right, as check_valid_map() does, up to the
+ * longest of the three rows: padding further right only touches padding.
+ *
+ * @param st Stream window, with the rows above and below loaded
+ * @return EXIT_SUCCESS if the row is closed, EXIT_FAILURE otherwise
+ */
+int	check_map_row(const t_map_stream *st)
+{
+	int		x;
+	int		end;
+	char	c;
+
+	end = max_int(st->lens[1], max_int(st->lens[0], st->lens[2]));
+	x = 0;
+	while (x < end)
+	{
+		c = cell_at(st, 1, x);
+		if (is_open(c) && check_open_cell(st, x) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+		if (c == ' ' && check_space_cell(st, x) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+		x++;
+	}
+	return (EXIT_SUCCESS);
+}
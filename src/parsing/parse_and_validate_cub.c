@@ -6,21 +6,37 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:58:52 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 13:58:56 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:53 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
+/**
+ * @brief Checks the header count, then parses the header into a string
+ *        block sized by that same read
+ */
+static int	read_header(char *path, t_map *map)
+{
+	size_t	bytes;
+
+	if (check_header_count(path, &bytes) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	if (arena_init(&map->strings, bytes) != EXIT_SUCCESS)
+		return (print_errors(TEXTURE_TRIM_FAIL, NULL, NULL), EXIT_FAILURE);
+	return (parse_header(path, map));
+}
+
 /**
  * @brief Parses and validates a .cub configuration file
  *
  * Orchestrates the full parsing pipeline for a Cub3D map file:
  *   - Verifies header count and identifiers
  *   - Parses texture paths and RGB colors
- *   - Parses the map grid
- *   - Initializes player position and orientation
- *   - Validates map structure and enclosure
+ *   - Loads the map grid, validating its structure and enclosure and
+ *     finding the player while the rows are read (load_valid_map())
+ *   - Crops the grid to the area reachable from the player spawn
+ *     (crop_to_reachable())
  *
  * Frees allocated map resources on failure.
  *
@@ -30,24 +46,36 @@
  */
 int	parse_and_validate_cub(char *path, t_game *game)
 {
-	if (check_header_count(path) != EXIT_SUCCESS)
-		return (EXIT_FAILURE);
-	if (parse_header(path, &game->map) != EXIT_SUCCESS)
-	{
-		free_t_map(&game->map);
-		return (EXIT_FAILURE);
-	}
-	if (parse_map(path, &game->map) != EXIT_SUCCESS)
+	if (read_header(path, &game->map) != EXIT_SUCCESS)
 	{
 		free_t_map(&game->map);
 		return (EXIT_FAILURE);
 	}
-	if (init_player(game) != EXIT_SUCCESS)
+	if (load_valid_map(path, game) != EXIT_SUCCESS
+		|| crop_to_reachable(game) != EXIT_SUCCESS)
 	{
 		free_t_map(&game->map);
 		return (EXIT_FAILURE);
 	}
-	if (check_valid_map(&game->map) != EXIT_SUCCESS)
-		return (free_t_map(&game->map), EXIT_FAILURE);
 	return (EXIT_SUCCESS);
 }
+
+/**
+ * @brief Validates a .cub file as parse_and_validate_cub(), without
+ *        loading the map grid
+ *
+ * Runs the same checks with the same errors, but streams the map through
+ * validate_map_file(), so memory use does not grow with the map height.
+ * Used by the --check batch validator. The header data (texture paths)
+ * is still allocated, and must be freed with free_t_map().
+ *
+ * @param path Path to the .cub file
+ * @param game Pointer to the game structure
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on error
+ */
+int	validate_cub(char *path, t_game *game)
+{
+	if (read_header(path, &game->map) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	return (validate_map_file(path, game));
+}
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:07:06 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 18:30:39 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:03 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,16 +19,16 @@
  * Updates the line counter. Returns false if EOF is reached.
  *
  * @param line Pointer to the current line buffer.
- * @param fd   File descriptor to read from.
+ * @param gnl  Reader of the file.
  * @param i    Pointer to current line index (will be incremented).
  * @return true if a non-empty line is found, false if EOF reached.
  */
-static bool	skip_empty_lines(char **line, int fd, int *i)
+static bool	skip_empty_lines(char **line, t_gnl *gnl, int *i)
 {
 	while (*line && line_is_empty(*line))
 	{
 		free(*line);
-		*line = get_next_line(fd);
+		*line = get_next_line_r(gnl);
 		(*i)++;
 	}
 	if (*line == NULL)
@@ -69,18 +69,18 @@ static bool	all_headers_set(t_map *map)
  *
  * @param map  Pointer to the map structure to update.
  * @param line Address of the current line buffer.
- * @param fd   File descriptor of the opened .cub file.
+ * @param gnl  Reader of the opened .cub file.
  * @param i    Pointer to the current line index in the file.
  *
  * @return true if the map start line was set successfully,
  *         false if headers are incomplete or an error occurs
  *         while skipping empty lines.
  */
-static bool	set_map_start_line(t_map *map, char **line, int fd, int *i)
+static bool	set_map_start_line(t_map *map, char **line, t_gnl *gnl, int *i)
 {
 	if (!all_headers_set(map))
 		return (false);
-	if (!skip_empty_lines(line, fd, i))
+	if (!skip_empty_lines(line, gnl, i))
 		return (false);
 	map->map_start_line = (*i);
 	return (true);
@@ -94,7 +94,9 @@ static bool	set_map_start_line(t_map *map, char **line, int fd, int *i)
  * lines are skipped as needed. Once headers are complete, the
  * start line of the map is detected and stored in map_start_line.
  *
- * The function stops parsing when the map section begins.
+ * The function stops parsing when the map section begins. Texture paths
+ * go to map->strings: the caller sizes it from check_header_count(),
+ * otherwise it grows as the paths come.
  *
  * @param path Path to the .cub file.
  * @param map Pointer to the map structure to populate.
@@ -104,28 +106,28 @@ static bool	set_map_start_line(t_map *map, char **line, int fd, int *i)
 int	parse_header(const char *path, t_map *map)
 {
 	int		i;
-	int		fd;
+	t_gnl	gnl;
 	char	*line;
 
-	fd = open_cub_file(path);
-	if (fd < 0)
+	gnl = (t_gnl){.fd = open_cub_file(path)};
+	if (gnl.fd < 0)
 		return (EXIT_FAILURE);
-	gnl_clear_fd(fd);
-	line = get_next_line(fd);
+	line = get_next_line_r(&gnl);
 	i = 0;
 	while (line)
 	{
-		if (!skip_empty_lines(&line, fd, &i))
-			return (gnl_clear_fd(fd), close(fd), EXIT_FAILURE);
+		if (!skip_empty_lines(&line, &gnl, &i))
+			return (gnl_release(&gnl), close(gnl.fd), EXIT_FAILURE);
 		if (parse_header_line(map, line) == EXIT_FAILURE)
-			return (gnl_clear_fd(fd), free(line), close(fd), EXIT_FAILURE);
-		next_line(&line, fd, &i);
-		if (set_map_start_line(map, &line, fd, &i))
+			return (gnl_release(&gnl), free(line), close(gnl.fd),
+				EXIT_FAILURE);
+		next_line(&line, &gnl, &i);
+		if (set_map_start_line(map, &line, &gnl, &i))
 		{
 			free(line);
 			break ;
 		}
 	}
-	gnl_clear_fd(fd);
-	return (close(fd), EXIT_SUCCESS);
+	gnl_release(&gnl);
+	return (close(gnl.fd), EXIT_SUCCESS);
 }
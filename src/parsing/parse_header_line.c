@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:06:58 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:07:00 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:52:03 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -37,13 +37,20 @@ static bool	validate_texture_file(const char *filename)
  *
  * Trims surrounding whitespace, checks for empty paths,
  * validates file existence, and stores the path in the map.
- * Replaces any previously stored path for the same id.
+ * Paths are copied into map->strings, one block freed at once by
+ * free_t_map(). The block is usually sized from the header lines
+ * (check_header_count()); when it is missing or full, it grows here,
+ * whatever the order and length of the paths.
  */
 static int	set_texture_path(t_map *map, t_header_type id, const char *path)
 {
 	char	*trimmed_value;
 
-	trimmed_value = ft_strtrim(path, " \t\n");
+	trimmed_value = arena_strtrim(&map->strings, path, " \t\n");
+	if (!trimmed_value && grow_header_strings(map,
+			ft_strlen(path) + 1)
+		== EXIT_SUCCESS)
+		trimmed_value = arena_strtrim(&map->strings, path, " \t\n");
 	if (!trimmed_value)
 	{
 		print_errors(TEXTURE_TRIM_FAIL, NULL, NULL);
@@ -52,16 +59,10 @@ static int	set_texture_path(t_map *map, t_header_type id, const char *path)
 	if (trimmed_value[0] == '\0')
 	{
 		print_errors(TEXTURE_EMPTY, NULL, NULL);
-		free(trimmed_value);
 		return (EXIT_FAILURE);
 	}
 	if (!validate_texture_file(trimmed_value))
-	{
-		free(trimmed_value);
 		return (EXIT_FAILURE);
-	}
-	if (map->tex_paths[id])
-		free(map->tex_paths[id]);
 	map->tex_paths[id] = trimmed_value;
 	return (EXIT_SUCCESS);
 }
@@ -70,18 +71,24 @@ static int	set_texture_path(t_map *map, t_header_type id, const char *path)
  * @brief Parse and assign an RGB color value to floor or ceiling
  *
  * Selects the correct color target based on the header id
- * and validates the RGB format and numeric ranges.
+ * and validates the RGB format and numeric ranges. The color is also
+ * packed into a pixel value here, once, so the renderer never has to.
  */
 static int	set_rgb_color(t_map *map, t_header_type id, const char *value)
 {
 	int	*rgb_values;
+	int	*packed;
 
+	rgb_values = map->ceiling_color;
+	packed = &map->ceiling_rgb;
 	if (id == ID_FLOOR)
+	{
 		rgb_values = map->floor_color;
-	else
-		rgb_values = map->ceiling_color;
+		packed = &map->floor_rgb;
+	}
 	if (parse_rgb(value, rgb_values) == EXIT_FAILURE)
 		return (EXIT_FAILURE);
+	*packed = rgb_tab_to_int(rgb_values);
 	return (EXIT_SUCCESS);
 }
 
@@ -90,6 +97,8 @@ static int	set_rgb_color(t_map *map, t_header_type id, const char *value)
  *
  * Detects duplicate headers, dispatches texture or color
  * parsing, and marks the identifier as successfully set.
+ * Wall headers always take a texture path; floor and ceiling take
+ * either an RGB color or an optional .xpm texture path.
  */
 static int	parse_header_value(t_map *map, const char *value, t_header_type id)
 {
@@ -98,7 +107,7 @@ static int	parse_header_value(t_map *map, const char *value, t_header_type id)
 		print_errors(HEADER_DUPLICATE, NULL, NULL);
 		return (EXIT_FAILURE);
 	}
-	if (id >= ID_NO && id <= ID_EA)
+	if ((id >= ID_NO && id <= ID_EA) || value_is_xpm_path(value))
 	{
 		if (set_texture_path(map, id, value) == EXIT_FAILURE)
 			return (EXIT_FAILURE);
@@ -6,171 +6,170 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:06:47 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 20:00:42 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:47:12 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
 /**
- * @brief Compute map width and height from a .cub file.
+ * @brief Reads the map rows once, appending each one to the row arenas.
  *
- * Reads the file line by line and counts only lines belonging to the map,
- * starting at map->map_start_line. The map width is set to the length of
- * the longest map line (excluding the trailing newline). The map height
- * is the number of map lines.
+ * Each row is fed to the streaming validator first, if any: an invalid
+ * map stops the reading at its first bad row, the rows before it kept.
+ * The row bytes go one after the other in rows[0], their lengths in
+ * rows[1], so no row is allocated on its own and the arenas only grow
+ * by doubling. The stream is not finished here (see build_grid()).
  *
- * @param path Path to the .cub file.
- * @param map  Pointer to the map structure to fill dimensions.
- *
- * @return EXIT_SUCCESS on success, EXIT_FAILURE on file open error.
+ * @param rd Reader of the .cub file, at the first map row.
+ * @param rows Arenas receiving the row bytes and the row lengths (int).
+ * @param map Map receiving the width and height of the rows kept.
+ * @param st Streaming validator, or NULL to load without validation.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on error.
  */
-static int	get_map_dimensions(const char *path, t_map *map)
+static int	read_rows(t_row_reader *rd, t_arena rows[2], t_map *map,
+		t_map_stream *st)
 {
-	int		fd;
-	int		len;
-	int		i;
-	char	*line;
+	const char	*row;
+	int			len;
 
-	fd = open_cub_file(path);
-	if (fd < 0)
-		return (EXIT_FAILURE);
-	gnl_clear_fd(fd);
-	i = 0;
-	line = get_next_line(fd);
-	while (line)
+	row = read_map_row(rd, &len);
+	while (row)
 	{
-		if (i >= map->map_start_line)
-		{
-			len = ft_strlen(line);
-			if (len > 0 && line[len - 1] == '\n')
-				len--;
-			map->width = max_int(map->width, len);
-			map->height++;
-		}
-		next_line(&line, fd, &i);
+		if (st && map_stream_push(st, row, len) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
+		if (arena_append(&rows[0], row, len) != EXIT_SUCCESS
+			|| arena_append(&rows[1], &len, sizeof(len)) != EXIT_SUCCESS)
+			return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+		map->width = max_int(map->width, len);
+		map->height++;
+		row = read_map_row(rd, &len);
 	}
-	gnl_clear_fd(fd);
-	return (close(fd), EXIT_SUCCESS);
+	if (rd->error)
+		return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Pads a line with spaces to match the map width.
- * @param row The input line from the .cub file.
- * @param width The desired width of the padded line.
- * @return A newly allocated string with padding, or NULL on malloc failure.
+ * @brief Copies the rows read into a single block, each padded with
+ *        spaces to map->width.
+ *
+ * The block holds the row pointers, then the rows one after the other,
+ * so neighbouring rows are adjacent in memory and free_map_grid() needs
+ * a single free().
+ *
+ * @param rows Row arenas filled by read_rows().
+ * @param map Map with the width and height of the rows; receives the
+ *            grid.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on malloc failure.
  */
-static char	*pad_line(const char *row, int width)
+static int	pad_grid(t_arena rows[2], t_map *map)
 {
-	char	*padded_line;
-	int		i;
+	t_arena		block;
+	const int	*lens;
+	const char	*src;
+	char		*dst;
+	int			y;
 
-	padded_line = malloc(width + 1);
-	if (!padded_line)
-		return (NULL);
-	i = 0;
-	while (row[i] && row[i] != '\n')
+	if (arena_init(&block, map->height * (sizeof(char *) + map->width + 1)
+			+ ARENA_ALIGN) != EXIT_SUCCESS)
+		return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+	map->grid = arena_alloc(&block, sizeof(char *) * map->height);
+	dst = arena_alloc(&block, (size_t)map->height * (map->width + 1));
+	lens = (const int *)rows[1].base;
+	src = rows[0].base;
+	y = -1;
+	while (++y < map->height)
 	{
-		padded_line[i] = row[i];
-		i++;
+		map->grid[y] = dst + (size_t)y * (map->width + 1);
+		ft_memcpy(map->grid[y], src, lens[y]);
+		ft_memset(map->grid[y] + lens[y], ' ', map->width - lens[y]);
+		map->grid[y][map->width] = '\0';
+		src += lens[y];
 	}
-	while (i < width)
-		padded_line[i++] = ' ';
-	padded_line[i] = '\0';
-	return (padded_line);
+	return (EXIT_SUCCESS);
 }
 
 /**
- * @brief Store a single line of the map into the map grid.
+ * @brief Pads the rows read into the grid, checks the rows the stream
+ *        left, and reports the first error.
  *
- * Pads the line to the map width and stores it in map->grid. Skips lines
- * before map_start_line. On allocation failure, frees allocated memory
- * for the partial grid and returns EXIT_FAILURE.
+ * The stream reports the error of a row (character, player, size) as
+ * soon as the row is read, and the enclosure of a row once the next one
+ * is read. The rows it left (past st->check_rows) are checked here in
+ * bands (check_map_rows()), up to the row above the one that stopped
+ * the reading: their errors came first. So the error printed is the
+ * one validate_map_file() prints for the same file.
  *
- * @param map Pointer to the map structure.
- * @param i Current line index in the .cub file.
- * @param y Pointer to the current row index in map->grid.
- * @param line Line content read from the .cub file.
- * @return EXIT_SUCCESS if line is stored or skipped, EXIT_FAILURE if
- *         memory allocation fails.
+ * @param rows Row arenas filled by read_rows().
+ * @param map Map with the width and height of the rows read.
+ * @param st Streaming validator, or NULL; its last rows are still in the
+ *           reader's buffers.
+ * @param error Error that stopped the reading, or NULL if every row
+ *              was read.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with the error printed.
  */
-static int	store_map_line(t_map *map, int i, int *y, char *line)
+static int	build_grid(t_arena rows[2], t_map *map, t_map_stream *st,
+		t_error_log *error)
 {
-	if (i < map->map_start_line)
-		return (EXIT_SUCCESS);
-	map->grid[*y] = pad_line(line, map->width);
-	if (!map->grid[*y])
+	int	end;
+
+	end = map->height - (error != NULL);
+	if (st && end > st->check_rows)
 	{
-		free(line);
-		free_partial_grid(map, *y);
-		return (EXIT_FAILURE);
+		if (pad_grid(rows, map) != EXIT_SUCCESS
+			|| check_map_rows(map, (const int *)rows[1].base,
+				st->check_rows, end) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
 	}
-	(*y)++;
+	else if (!error && pad_grid(rows, map) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	if (error)
+		return (print_errors(error->msg, NULL, NULL), EXIT_FAILURE);
+	if (st)
+		return (map_stream_finish(st));
 	return (EXIT_SUCCESS);
 }
 
 /**
  * @brief Loads the map grid from a .cub file into map->grid.
  *
- * Reads each line from the file, pads it to the map width, and stores it in
- * map->grid. Skips header lines before map_start_line. Frees memory and closes
- * the file on error.
+ * Reads the rows from map_start_line once, through a t_row_reader,
+ * validating them on the way when a stream is given, then pads them
+ * into the grid block: the grid is made of the very rows the stream
+ * validated. Errors met while reading are held back until the rows
+ * before them are checked (build_grid()). Frees everything on error.
  *
  * @param path Path to the .cub file.
  * @param map Pointer to the t_map structure to populate.
- * @return EXIT_SUCCESS on success, EXIT_FAILURE on malloc or I/O failure.
+ * @param st Streaming validator (map_stream_init()), or NULL to skip
+ *           validation.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on error.
  */
-static int	load_map_grid(const char *path, t_map *map)
+int	load_map_grid(const char *path, t_map *map, t_map_stream *st)
 {
-	int		y;
-	int		fd;
-	int		i;
-	char	*line;
+	t_row_reader	rd;
+	t_arena			rows[2];
+	t_error_log		log;
+	t_error_log		*saved;
+	int				status;
 
-	fd = open_cub_file(path);
-	if (fd < 0)
-		return (EXIT_FAILURE);
-	gnl_clear_fd(fd);
-	map->grid = malloc(sizeof (char *) * map->height);
-	if (!map->grid)
-		return (close(fd), EXIT_FAILURE);
-	y = 0;
-	i = 0;
-	line = get_next_line(fd);
-	while (line)
-	{
-		if (store_map_line(map, i, &y, line) == EXIT_FAILURE)
-			return (free(line), close(fd), EXIT_FAILURE);
-		next_line(&line, fd, &i);
-	}
-	gnl_clear_fd(fd);
-	close(fd);
-	return (EXIT_SUCCESS);
-}
-
-/**
- * @brief Parses a .cub file and fills the t_map structure.
- * 
- * It reads the .cub file, calculates dimensions, and loads the grid.
- *
- * @param path Path to the .cub file.
- * @param map Pointer to t_map structure to fill.
- * @return EXIT_SUCCESS on success, EXIT_FAILURE on failure.
- *
- * @note **Currently, no validation of the map contents is performed.**
- *       Only the map dimensions and grid are loaded and padded.
- */
-int	parse_map(const char *path, t_map *map)
-{
-	if (get_map_dimensions(path, map))
-	{
-		print_errors(MAP_DIMENSIONS, NULL, NULL);
-		return (EXIT_FAILURE);
-	}
-	if (load_map_grid(path, map))
-	{
-		print_errors(MAP_LOAD, NULL, NULL);
-		return (EXIT_FAILURE);
-	}
-	return (EXIT_SUCCESS);
+	if (open_map_rows(&rd, path, map->map_start_line) != EXIT_SUCCESS)
+		return (print_errors(MAP_LOAD, NULL, NULL), EXIT_FAILURE);
+	ft_bzero(rows, sizeof(rows));
+	ft_bzero(&log, sizeof(log));
+	saved = *error_log();
+	*error_log() = &log;
+	status = read_rows(&rd, rows, map, st);
+	*error_log() = saved;
+	if (status == EXIT_SUCCESS)
+		status = build_grid(rows, map, st, NULL);
+	else
+		status = build_grid(rows, map, st, &log);
+	close_map_rows(&rd);
+	arena_free(&rows[0]);
+	arena_free(&rows[1]);
+	if (status != EXIT_SUCCESS)
+		free_map_grid(map);
+	return (status);
 }
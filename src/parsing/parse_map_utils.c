@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:08:07 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:08:09 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 09:22:10 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -51,82 +51,57 @@ int	open_cub_file(const char *path)
  * that were already present in the map. It does not distinguish
  * between the two.
  *
+ * The grid goes through an output buffer, so it takes one write per
+ * FT_OUTBUF_SIZE bytes instead of one per cell. Only printed with
+ * --verbose (see print_startup_info()).
+ *
  * Does not modify the map.
  *
  * @param map Pointer to the t_map structure containing the grid.
  */
 void	print_map_grid(t_map *map)
 {
-	int		y;
-	int		x;
-	char	c;
+	t_outbuf	out;
+	int			y;
+	int			x;
 
 	if (!map || !map->grid)
 		return ;
-	printf(MAG "Map dimensions: %d x %d\n" RESET, map->width, map->height);
-	y = 0;
-	while (y < map->height)
+	ft_outbuf_init(&out, STDOUT_FILENO);
+	ft_outbuf_putfield(&out, MAG "Map dimensions: ", map->width);
+	ft_outbuf_putfield(&out, " x ", map->height);
+	ft_outbuf_putstr(&out, "\n" RESET);
+	y = -1;
+	while (++y < map->height)
 	{
-		x = 0;
-		while (x < map->width)
+		x = -1;
+		while (++x < map->width)
 		{
-			c = map->grid[y][x];
-			if (c == ' ')
-				ft_putchar_fd('.', 1);
+			if (map->grid[y][x] == ' ')
+				ft_outbuf_putchar(&out, '.');
 			else
-				ft_putchar_fd(c, 1);
-			x++;
+				ft_outbuf_putchar(&out, map->grid[y][x]);
 		}
-		ft_putchar_fd('\n', 1);
-		y++;
+		ft_outbuf_putchar(&out, '\n');
 	}
+	ft_outbuf_flush(&out);
 }
 
 /**
  * @brief Frees all memory allocated for the map grid.
  *
- * Frees each row of map->grid, then the grid itself.
+ * The grid is a single block, its row pointers followed by the rows
+ * (see load_map_grid()), so one free() releases it.
  * Resets map width and height to 0. Safe to call on NULL pointers.
  *
  * @param map Pointer to the t_map structure to free.
  */
 void	free_map_grid(t_map *map)
 {
-	int	i;
-
 	if (!map)
 		return ;
-	if (map->grid)
-	{
-		i = 0;
-		while (i < map->height)
-		{
-			free(map->grid[i]);
-			i++;
-		}
-		free(map->grid);
-		map->grid = NULL;
-	}
-	map->width = 0;
-	map->height = 0;
-}
-
-/**
- * @brief Frees a partially allocated map grid.
- *
- * This function is used when the grid allocation fails partway through.
- * It frees all rows that were successfully allocated up to `filled_rows`,
- * then frees the grid pointer itself and resets it to NULL to avoid
- * dangling references.
- *
- * @param map          Pointer to the map structure containing the grid.
- * @param filled_rows  Number of rows that were successfully allocated.
- *                     Only rows in the range [0, filled_rows - 1] will be freed.
- */
-void	free_partial_grid(t_map *map, int filled_rows)
-{
-	while (--filled_rows >= 0)
-		free(map->grid[filled_rows]);
 	free(map->grid);
 	map->grid = NULL;
+	map->width = 0;
+	map->height = 0;
 }
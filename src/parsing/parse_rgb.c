@@ -6,29 +6,42 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:07:18 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:07:20 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:38:35 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
 /**
- * @brief Parses and validates a single RGB component
+ * @brief Parses and validates a single RGB component, in place
  *
- * Converts a string to an integer and verifies it's in valid range [0-255].
- * Uses ft_safe_atoi to ensure the string represents a valid integer.
+ * Accepts what ft_safe_atoi() accepts (surrounding whitespace, an
+ * optional sign, at least one digit), as long as the value is in the
+ * valid range [0-255].
  *
- * @param str String representation of the RGB value
+ * @param field Component, without its commas
  * @param value Pointer to store the parsed integer value
  * @return EXIT_SUCCESS if valid, EXIT_FAILURE otherwise
  */
-static int	parse_rgb_component(const char *str, int *value)
+static int	parse_rgb_component(t_view field, int *value)
 {
-	int	rgb_value;
+	size_t	i;
+	bool	negative;
+	int		rgb_value;
 
-	if (!ft_safe_atoi(str, &rgb_value))
+	i = 0;
+	while (i < field.len && ft_isspace(field.s[i]))
+		i++;
+	negative = i < field.len && field.s[i] == '-';
+	i += i < field.len && (field.s[i] == '-' || field.s[i] == '+');
+	if (i == field.len || !ft_isdigit(field.s[i]))
 		return (EXIT_FAILURE);
-	if (rgb_value < 0 || rgb_value > 255)
+	rgb_value = 0;
+	while (i < field.len && ft_isdigit(field.s[i]) && rgb_value <= 255)
+		rgb_value = rgb_value * 10 + (field.s[i++] - '0');
+	while (i < field.len && ft_isspace(field.s[i]))
+		i++;
+	if (i != field.len || rgb_value > 255 || (negative && rgb_value != 0))
 		return (EXIT_FAILURE);
 	*value = rgb_value;
 	return (EXIT_SUCCESS);
@@ -37,7 +50,8 @@ static int	parse_rgb_component(const char *str, int *value)
 /**
  * @brief Parses an RGB color string in format "R,G,B"
  *
- * Splits the input string by commas and validates each component:
+ * Walks the comma separated components in place (empty ones are
+ * skipped), without allocating, and validates each of them:
  *   - Must have exactly 3 components
  *   - Each component must be an integer in range [0-255]
  *
@@ -49,28 +63,24 @@ static int	parse_rgb_component(const char *str, int *value)
  */
 int	parse_rgb(const char *value, int rgb_values[RGB_SIZE])
 {
-	char	**rgb_strs;
+	t_view	field;
 	int		i;
 
-	rgb_strs = ft_split(value, ',');
-	if (!rgb_strs)
-		return (print_errors(RGB_SPLIT_FAIL, NULL, NULL), EXIT_FAILURE);
 	i = 0;
 	while (i < RGB_SIZE)
 	{
-		if (!rgb_strs[i] || parse_rgb_component(rgb_strs[i], &rgb_values[i]))
+		if (!view_next_field(&value, ',', &field)
+			|| parse_rgb_component(field, &rgb_values[i]))
 		{
 			print_errors(RGB_INVALID_FORMAT, NULL, NULL);
-			return (free_strings_array(rgb_strs), EXIT_FAILURE);
+			return (EXIT_FAILURE);
 		}
 		i++;
 	}
-	if (rgb_strs[RGB_SIZE] != NULL)
+	if (view_next_field(&value, ',', &field))
 	{
 		print_errors(RGB_TOO_MANY, NULL, NULL);
-		free_strings_array(rgb_strs);
 		return (EXIT_FAILURE);
 	}
-	free_strings_array(rgb_strs);
 	return (EXIT_SUCCESS);
 }
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:07:44 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 20:03:54 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:09:31 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -76,30 +76,29 @@ static const t_orientation	*get_orientation(size_t *count)
  * Uses the get_orientation() lookup table to find the correct direction vectors.
  * If the character is invalid, an error message is printed.
  *
- * @param game Pointer to the game struct containing the player and map.
- * @param y Row index of the player in the map grid.
+ * @param player Player to place.
  * @param x Column index of the player in the map grid.
+ * @param y Row index of the player in the map grid.
+ * @param c Orientation character found in the map.
  */
-static void	set_player_position(t_game *game, int y, int x)
+void	set_player_position(t_player *player, int x, int y, char c)
 {
 	size_t				i;
-	char				c;
 	size_t				count;
 	const t_orientation	*orient;
 
-	c = game->map.grid[y][x];
-	game->player.pos_x = x + TILE_CENTER_OFFSET;
-	game->player.pos_y = y + TILE_CENTER_OFFSET;
+	player->pos_x = x + TILE_CENTER_OFFSET;
+	player->pos_y = y + TILE_CENTER_OFFSET;
 	orient = get_orientation(&count);
 	i = 0;
 	while (i < count)
 	{
 		if (orient[i].c == c)
 		{
-			game->player.dir_x = orient[i].dir_x;
-			game->player.dir_y = orient[i].dir_y;
-			game->player.plane_x = orient[i].plane_x;
-			game->player.plane_y = orient[i].plane_y;
+			player->dir_x = orient[i].dir_x;
+			player->dir_y = orient[i].dir_y;
+			player->plane_x = orient[i].plane_x;
+			player->plane_y = orient[i].plane_y;
 			return ;
 		}
 		i++;
@@ -135,7 +134,7 @@ static int	set_player(t_game *game, int *player_found, int y, int x)
 			return (EXIT_FAILURE);
 		}
 		*player_found = 1;
-		set_player_position(game, y, x);
+		set_player_position(&game->player, x, y, game->map.grid[y][x]);
 		game->map.grid[y][x] = '0';
 	}
 	return (EXIT_SUCCESS);
@@ -6,46 +6,12 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:03:27 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 20:12:57 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:17:20 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
-/**
- * @brief Ensure all map characters are valid ('0', '1', or space).
- *
- * Iterates the map grid. Prints an error and returns EXIT_FAILURE if any
- * invalid character is found.
- *
- * @param map Pointer to the t_map structure.
- * @return EXIT_SUCCESS if all characters are valid, else EXIT_FAILURE.
- */
-static int	check_allowed_chars(t_map *map)
-{
-	int		y;
-	int		x;
-	char	c;
-
-	y = 0;
-	while (y < map->height)
-	{
-		x = 0;
-		while (x < map->width)
-		{
-			c = map->grid[y][x];
-			if (c != '1' && c != '0' && c != ' ')
-			{
-				print_errors(MAP_CHAR, NULL, NULL);
-				return (EXIT_FAILURE);
-			}
-			x++;
-		}
-		y++;
-	}
-	return (EXIT_SUCCESS);
-}
-
 /**
  * @brief Check if coordinates are within the map boundaries.
  *
@@ -143,39 +109,47 @@ static int	check_space_adjacent(t_map *map, int y, int x)
 }
 
 /**
- * @brief Validate the map by checking all characters and adjacency rules.
+ * @brief Check one cell: allowed character and adjacency rules.
  *
- * Iterates through the map grid and checks each cell:
+ *  - only '0', '1' and ' ' are allowed (the player is already replaced).
  *  - '0' cells must be surrounded by '0' or '1'.
  *  - ' ' cells must not touch any '0'.
  *
  * @param map Pointer to the map structure.
- * @return EXIT_SUCCESS if all checks pass, EXIT_FAILURE otherwise.
+ * @param y   Row index of the cell.
+ * @param x   Column index of the cell.
+ * @return EXIT_SUCCESS if the cell is valid, EXIT_FAILURE otherwise.
  */
-int	check_valid_map(t_map *map)
+int	check_map_cell(t_map *map, int y, int x)
 {
-	int	y;
-	int	x;
+	char	c;
 
-	if (map->width > MAX_MAP_W || map->height > MAX_MAP_H)
-		return (print_errors(MAP_TOO_LARGE, NULL, NULL), EXIT_FAILURE);
-	if (check_allowed_chars(map) == EXIT_FAILURE)
-		return (EXIT_FAILURE);
-	y = 0;
-	while (y < map->height)
+	c = map->grid[y][x];
+	if (c == '0')
+		return (check_zero_adjacent(map, y, x));
+	if (c == ' ')
+		return (check_space_adjacent(map, y, x));
+	if (c != '1')
 	{
-		x = 0;
-		while (x < map->width)
-		{
-			if (map->grid[y][x] == '0'
-				&& check_zero_adjacent(map, y, x) == EXIT_FAILURE)
-				return (EXIT_FAILURE);
-			else if (map->grid[y][x] == ' '
-				&& check_space_adjacent(map, y, x) == EXIT_FAILURE)
-				return (EXIT_FAILURE);
-			x++;
-		}
-		y++;
+		print_errors(MAP_CHAR, NULL, NULL);
+		return (EXIT_FAILURE);
 	}
 	return (EXIT_SUCCESS);
 }
+
+/**
+ * @brief Validate the map by checking all characters and adjacency rules.
+ *
+ * Checks every cell with check_map_cell(). Large maps are split into
+ * bands of rows checked by several threads (check_map_bands()); the
+ * error reported is always the first one in row-major order.
+ *
+ * @param map Pointer to the map structure.
+ * @return EXIT_SUCCESS if all checks pass, EXIT_FAILURE otherwise.
+ */
+int	check_valid_map(t_map *map)
+{
+	if (map->width > MAX_MAP_W || map->height > MAX_MAP_H)
+		return (print_errors(MAP_TOO_LARGE, NULL, NULL), EXIT_FAILURE);
+	return (check_map_bands(map, map_band_count(map)));
+}
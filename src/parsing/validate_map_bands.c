@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   validate_map_bands.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:17:20 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:47:12 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Publishes the band's error, and tells whether the band is done.
+ *
+ * A band is done once it found an error, or once an error is known
+ * before row y: the errors of this band would come later in row-major
+ * order, so they can no longer be the one reported.
+ *
+ * @param band Band being checked.
+ * @param y Next row of the band to check.
+ * @return true if the band can stop, false otherwise.
+ */
+static bool	band_done(t_band *band, int y)
+{
+	t_band_check	*chk;
+	bool			done;
+
+	chk = band->shared;
+	pthread_mutex_lock(&chk->lock);
+	if (band->error_at >= 0
+		&& (chk->first_error < 0 || band->error_at < chk->first_error))
+		chk->first_error = band->error_at;
+	done = band->error_at >= 0 || (chk->first_error >= 0
+			&& chk->first_error < (long)y * chk->map->width);
+	pthread_mutex_unlock(&chk->lock);
+	return (done);
+}
+
+/**
+ * @brief Checks the rows of a band, up to its first error (thread entry).
+ *
+ * Rows near the band edges read their neighbours in the next bands
+ * directly from the grid, which no thread modifies. Error messages go
+ * to the band's own log, the caller prints the one that wins.
+ *
+ * @param arg Band to check (t_band *).
+ * @return NULL.
+ */
+static void	*check_band(void *arg)
+{
+	t_band		*band;
+	t_error_log	*saved;
+	int			y;
+	int			x;
+
+	band = arg;
+	saved = *error_log();
+	*error_log() = &band->log;
+	y = band->y0;
+	while (y < band->y1 && !band_done(band, y))
+	{
+		x = check_map_band_row(band->shared, y);
+		if (x >= 0)
+			band->error_at = (long)y * band->shared->map->width + x;
+		y++;
+	}
+	band_done(band, y);
+	*error_log() = saved;
+	return (NULL);
+}
+
+/**
+ * @brief Splits the rows into bands and checks them, one thread each.
+ *
+ * The calling thread checks the first band itself, and any band whose
+ * thread could not be started.
+ *
+ * @param chk Shared state (map, rows, first error known).
+ * @param bands Bands to fill, jobs of them.
+ * @param jobs Number of bands, from 1 to the number of rows.
+ */
+static void	run_bands(t_band_check *chk, t_band *bands, int jobs)
+{
+	int	i;
+
+	i = -1;
+	while (++i < jobs)
+	{
+		bands[i] = (t_band){.shared = chk, .error_at = -1,
+			.y0 = chk->y0 + (long)(chk->y1 - chk->y0) * i / jobs,
+			.y1 = chk->y0 + (long)(chk->y1 - chk->y0) * (i + 1) / jobs};
+		bands[i].started = i > 0
+			&& pthread_create(&bands[i].thread, NULL, check_band,
+				&bands[i]) == 0;
+	}
+	i = -1;
+	while (++i < jobs)
+	{
+		if (bands[i].started)
+			pthread_join(bands[i].thread, NULL);
+		else
+			check_band(&bands[i]);
+	}
+}
+
+/**
+ * @brief Picks the number of bands for a map: one per CPU, each at least
+ *        MAP_BAND_MIN_ROWS rows, so small maps stay on one thread (and
+ *        skip the CPU count query).
+ *
+ * @param map Map to check.
+ * @return Number of bands, from 1 to MAP_BAND_MAX.
+ */
+int	map_band_count(const t_map *map)
+{
+	long	jobs;
+
+	if (map->height < 2 * MAP_BAND_MIN_ROWS)
+		return (1);
+	jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (jobs > map->height / MAP_BAND_MIN_ROWS)
+		jobs = map->height / MAP_BAND_MIN_ROWS;
+	if (jobs > MAP_BAND_MAX)
+		jobs = MAP_BAND_MAX;
+	if (jobs < 1)
+		return (1);
+	return ((int)jobs);
+}
+
+/**
+ * @brief Checks rows [chk->y0, chk->y1) of a map (check_map_band_row()),
+ *        split into bands checked concurrently.
+ *
+ * The error printed is the first one in row-major order, as a single
+ * thread would find it, whatever the number of bands.
+ *
+ * @param chk Map, rows and row lengths to check; the rest is set here.
+ * @param jobs Number of bands, clamped to [1, min(MAP_BAND_MAX, rows)].
+ * @return EXIT_SUCCESS if every row is valid, EXIT_FAILURE otherwise.
+ */
+int	check_band_rows(t_band_check *chk, int jobs)
+{
+	t_band	bands[MAP_BAND_MAX];
+	int		i;
+
+	if (jobs > MAP_BAND_MAX)
+		jobs = MAP_BAND_MAX;
+	if (jobs > chk->y1 - chk->y0)
+		jobs = chk->y1 - chk->y0;
+	if (jobs < 1)
+		jobs = 1;
+	chk->first_error = -1;
+	pthread_mutex_init(&chk->lock, NULL);
+	run_bands(chk, bands, jobs);
+	pthread_mutex_destroy(&chk->lock);
+	i = 0;
+	while (i < jobs && bands[i].error_at < 0)
+		i++;
+	if (i == jobs)
+		return (EXIT_SUCCESS);
+	print_errors(bands[i].log.msg, NULL, NULL);
+	return (EXIT_FAILURE);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   validate_map_rows.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:43:17 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:47:12 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Checks one row of a banded check.
+ *
+ * Without row lengths, every cell of the padded grid is checked with
+ * check_map_cell(). With them, the row is checked as the streaming
+ * validator checks it (check_map_row()), from the rows as they were
+ * read: the padding past a row's length is not part of it, and the
+ * errors are the ones validate_map_file() reports.
+ *
+ * @param chk Banded check (map, row lengths or NULL).
+ * @param y Row to check.
+ * @return Column of the first error (0 for a row check), -1 if valid.
+ */
+int	check_map_band_row(t_band_check *chk, int y)
+{
+	t_map_stream	st;
+	int				x;
+
+	if (!chk->lens)
+	{
+		x = -1;
+		while (++x < chk->map->width)
+			if (check_map_cell(chk->map, y, x) != EXIT_SUCCESS)
+				return (x);
+		return (-1);
+	}
+	ft_bzero(&st, sizeof(st));
+	x = -1;
+	while (++x < 3)
+	{
+		if (y - 1 + x >= 0 && y - 1 + x < chk->map->height)
+		{
+			st.rows[x] = chk->map->grid[y - 1 + x];
+			st.lens[x] = chk->lens[y - 1 + x];
+		}
+	}
+	if (check_map_row(&st) != EXIT_SUCCESS)
+		return (0);
+	return (-1);
+}
+
+/**
+ * @brief Checks every cell of a map (check_map_cell()), with the rows
+ *        split into bands checked concurrently (check_band_rows()).
+ *
+ * @param map Map to check (no size limit).
+ * @param jobs Number of bands, clamped to [1, min(MAP_BAND_MAX, height)].
+ * @return EXIT_SUCCESS if every cell is valid, EXIT_FAILURE otherwise.
+ */
+int	check_map_bands(t_map *map, int jobs)
+{
+	t_band_check	chk;
+
+	chk = (t_band_check){.map = map, .y0 = 0, .y1 = map->height};
+	return (check_band_rows(&chk, jobs));
+}
+
+/**
+ * @brief Checks rows [y0, y1) of a loaded map as the streaming validator
+ *        would, in bands checked concurrently.
+ *
+ * For the rows a loader left to check after the stream
+ * (t_map_stream.check_rows): the first error printed is the one
+ * map_stream_push() would have printed for them.
+ *
+ * @param map Loaded map, rows padded to map->width.
+ * @param lens Length of each row as read, before padding.
+ * @param y0 First row to check.
+ * @param y1 Row after the last one to check.
+ * @return EXIT_SUCCESS if every row is closed, EXIT_FAILURE otherwise.
+ */
+int	check_map_rows(t_map *map, const int *lens, int y0, int y1)
+{
+	t_band_check	chk;
+
+	chk = (t_band_check){.map = map, .lens = lens, .y0 = y0, .y1 = y1};
+	return (check_band_rows(&chk, map_band_count(map)));
+}
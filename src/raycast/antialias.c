@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   antialias.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:31:29 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:31:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Checks if two neighbouring columns show a geometry edge
+ *
+ * @param a Drawing info of the first column
+ * @param b Drawing info of the second column
+ * @return true if only one ray found a wall in range, or both hit a
+ *         different cell or side, or their distances differ by more than
+ *         AA_DEPTH_RATIO of the nearest one
+ */
+static bool	columns_differ(const t_draw_info *a, const t_draw_info *b)
+{
+	if (a->far || b->far)
+		return (a->far != b->far);
+	if (a->map_x != b->map_x || a->map_y != b->map_y
+		|| a->wall_dir != b->wall_dir)
+		return (true);
+	return (fabs(a->wall_dist - b->wall_dist)
+		> AA_DEPTH_RATIO * fmin(a->wall_dist, b->wall_dist));
+}
+
+/**
+ * @brief Checks if column x differs from its left or right neighbour
+ *
+ * @param game Pointer to the game structure
+ * @param x Screen column index
+ * @return true if the column sits on a geometry edge
+ */
+static bool	is_edge_column(t_game *game, int x)
+{
+	t_draw_info	*columns;
+
+	columns = game->frame.columns;
+	if (x > 0 && columns_differ(&columns[x - 1], &columns[x]))
+		return (true);
+	return (x + 1 < game->frame.width
+		&& columns_differ(&columns[x], &columns[x + 1]));
+}
+
+/**
+ * @brief Traces one sub-column ray of column x
+ *
+ * The game->aa_samples rays are spread evenly over the width of the
+ * column, centered on the column's own ray.
+ *
+ * @param game Pointer to the game structure
+ * @param x Screen column index
+ * @param sample Sample index, 0 to game->aa_samples - 1
+ * @return Drawing info of the sample, drawn into column x
+ */
+static t_draw_info	sub_column(t_game *game, int x, int sample)
+{
+	double			camera_x;
+	double			ray_dir_x;
+	double			ray_dir_y;
+	t_ray_result	result;
+
+	camera_x = game->frame.camera_x[x] + 2.0 / game->frame.width
+		* ((sample + 0.5) / game->aa_samples - 0.5);
+	ray_dir_x = game->player.dir_x + game->player.plane_x * camera_x;
+	ray_dir_y = game->player.dir_y + game->player.plane_y * camera_x;
+	result = cast_ray(game, ray_dir_x, ray_dir_y);
+	game->frame.dda_steps += result.steps;
+	return (wall_column_info(game, x, result));
+}
+
+/**
+ * @brief Draws column x as the average of its sub-column samples
+ *
+ * Only the rows covered by at least one sample's slice can differ from
+ * the background, so only those are drawn, summed and restored for each
+ * sample, then replaced by the blend.
+ *
+ * @param game Pointer to the game structure (background already drawn)
+ * @param x Screen column index
+ */
+static void	supersample_column(t_game *game, int x)
+{
+	t_draw_info	samples[AA_MAX_SAMPLES];
+	int			start;
+	int			end;
+	int			s;
+
+	start = game->frame.height;
+	end = -1;
+	s = 0;
+	while (s < game->aa_samples)
+	{
+		samples[s] = sub_column(game, x, s);
+		if (samples[s].draw_start < start)
+			start = samples[s].draw_start;
+		if (samples[s].draw_end > end)
+			end = samples[s].draw_end;
+		s++;
+	}
+	save_column(game, x, start, end);
+	s = 0;
+	while (s < game->aa_samples)
+	{
+		draw_column(game, samples[s++]);
+		accumulate_column(game, x, start, end);
+	}
+	resolve_column(game, x, start, end);
+}
+
+/**
+ * @brief Column pass: draws every recorded wall slice over the background
+ *
+ * With --aa N, columns whose neighbours hit a different cell or side, or
+ * sit at a very different distance, are traced again with N sub-column
+ * rays and blended (edge anti-aliasing). All other columns keep their
+ * single ray. frame.aa_columns counts the supersampled columns.
+ *
+ * @param game Pointer to the game structure (background already drawn)
+ */
+void	draw_walls(t_game *game)
+{
+	int	x;
+
+	game->frame.aa_columns = 0;
+	x = 0;
+	while (x < game->frame.width)
+	{
+		if (game->aa_samples > 1 && is_edge_column(game, x))
+		{
+			supersample_column(game, x);
+			game->frame.aa_columns++;
+		}
+		else
+			draw_column(game, game->frame.columns[x]);
+		x++;
+	}
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   antialias_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:31:29 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:31:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Saves the background of rows start to end of column x
+ *
+ * frame.aa_rows holds the saved pixel of each row, followed by three
+ * channel sums per row, which are cleared here.
+ *
+ * @param game Pointer to the game structure
+ * @param x Screen column index
+ * @param start First row
+ * @param end Last row
+ */
+void	save_column(t_game *game, int x, int start, int end)
+{
+	unsigned int	*sums;
+	int				y;
+
+	sums = game->frame.aa_rows + game->frame.height;
+	y = start;
+	while (y <= end)
+	{
+		game->frame.aa_rows[y] = game->frame.pixels[y * game->frame.stride
+			+ x];
+		sums[y * 3] = 0;
+		sums[y * 3 + 1] = 0;
+		sums[y * 3 + 2] = 0;
+		y++;
+	}
+}
+
+/**
+ * @brief Adds the drawn sample to the channel sums, restores background
+ *
+ * @param game Pointer to the game structure
+ * @param x Screen column index
+ * @param start First row
+ * @param end Last row
+ */
+void	accumulate_column(t_game *game, int x, int start, int end)
+{
+	unsigned int	*sums;
+	unsigned int	*dst;
+	int				y;
+
+	sums = game->frame.aa_rows + game->frame.height;
+	y = start;
+	while (y <= end)
+	{
+		dst = game->frame.pixels + y * game->frame.stride + x;
+		sums[y * 3] += (*dst >> 16) & 0xFF;
+		sums[y * 3 + 1] += (*dst >> 8) & 0xFF;
+		sums[y * 3 + 2] += *dst & 0xFF;
+		*dst = game->frame.aa_rows[y];
+		y++;
+	}
+}
+
+/**
+ * @brief Writes the rounded average of the game->aa_samples samples
+ *
+ * @param game Pointer to the game structure
+ * @param x Screen column index
+ * @param start First row
+ * @param end Last row
+ */
+void	resolve_column(t_game *game, int x, int start, int end)
+{
+	unsigned int	*sums;
+	unsigned int	n;
+	int				y;
+
+	sums = game->frame.aa_rows + game->frame.height;
+	n = game->aa_samples;
+	y = start;
+	while (y <= end)
+	{
+		game->frame.pixels[y * game->frame.stride + x]
+			= (sums[y * 3] + n / 2) / n << 16
+			| (sums[y * 3 + 1] + n / 2) / n << 8
+			| (sums[y * 3 + 2] + n / 2) / n;
+		y++;
+	}
+}
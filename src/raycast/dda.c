@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:10:14 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 18:13:39 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:27:55 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -71,6 +71,9 @@ static void	calculate_side_dist(t_ray *ray, double pos_x, double pos_y)
  *
  * Steps through the grid line by line until hitting a wall.
  * Updates ray.side to indicate if wall is vertical (0) or horizontal (1).
+ * Stops early, with ray.far set, once the next grid line is further
+ * than ray.max_dist, which bounds the work per ray on large open maps.
+ * ray.steps counts the grid lines crossed.
  *
  * @param game Pointer to the game structure (contains the map)
  * @param ray Pointer to the ray structure
@@ -82,6 +85,11 @@ static void	perform_dda(t_game *game, t_ray *ray)
 	hit = false;
 	while (!hit)
 	{
+		if (fmin(ray->side_dist_x, ray->side_dist_y) > ray->max_dist)
+		{
+			ray->far = true;
+			return ;
+		}
 		if (ray->side_dist_x < ray->side_dist_y)
 		{
 			ray->side_dist_x += ray->delta_dist_x;
@@ -94,45 +102,28 @@ static void	perform_dda(t_game *game, t_ray *ray)
 			ray->map_y += ray->step_y;
 			ray->side = HORIZONTAL_WALL;
 		}
+		ray->steps++;
 		hit = check_hit(game, ray);
 	}
 }
 
-/**
- * @brief Calculates the perpendicular wall distance
- *
- * Uses perpendicular distance (not euclidean) to avoid fisheye effect.
- * Subtracts the last delta_dist that was added in the DDA loop.
- *
- * @param ray Pointer to the ray structure
- * @return The perpendicular distance to the wall
- */
-static double	calculate_wall_distance(t_ray *ray)
-{
-	double	perp_wall_dist;
-
-	if (ray->side == VERTICAL_WALL)
-		perp_wall_dist = (ray->side_dist_x - ray->delta_dist_x);
-	else
-		perp_wall_dist = (ray->side_dist_y - ray->delta_dist_y);
-	return (perp_wall_dist);
-}
-
 /**
  * @brief Casts a ray and returns all raycasting results
  *
  * This is the main DDA function that initializes the ray and finds
  * the distance to the nearest wall, its direction, and exact hit position.
+ * Rays that pass max_ray_distance() stop there and come back as "far",
+ * with wall_dist set to the limit.
  *
  * @param game Pointer to the game structure
  * @param ray_dir_x X component of the ray direction
  * @param ray_dir_y Y component of the ray direction
- * @return t_ray_result containing wall_dist, wall_dir, and wall_x
+ * @return t_ray_result containing wall_dist, wall_dir, wall_x, the far
+ *         flag, the hit cell and the number of DDA steps taken
  */
 t_ray_result	cast_ray(t_game *game, double ray_dir_x, double ray_dir_y)
 {
-	t_ray			ray;
-	t_ray_result	result;
+	t_ray	ray;
 
 	ray.dir_x = ray_dir_x;
 	ray.dir_y = ray_dir_y;
@@ -140,10 +131,10 @@ t_ray_result	cast_ray(t_game *game, double ray_dir_x, double ray_dir_y)
 	ray.map_y = (int)game->player.pos_y;
 	calculate_delta_dist(&ray);
 	calculate_side_dist(&ray, game->player.pos_x, game->player.pos_y);
+	ray.side = VERTICAL_WALL;
+	ray.far = false;
+	ray.steps = 0;
+	ray.max_dist = max_ray_distance(game);
 	perform_dda(game, &ray);
-	result.wall_dir = get_wall_direction(&ray);
-	result.wall_dist = calculate_wall_distance(&ray);
-	result.wall_x = calculate_wall_x(&ray, game->player.pos_x,
-			game->player.pos_y, result.wall_dist);
-	return (result);
+	return (ray_hit_result(game, &ray));
 }
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:10:07 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:10:09 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:27:55 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -81,3 +81,58 @@ int	get_wall_direction(t_ray *ray)
 		return (ID_SO);
 	return (ID_NO);
 }
+
+/**
+ * @brief Returns how far rays may travel before giving up
+ *
+ * The limit is the --max-dist setting, or the fog distance if that is
+ * shorter, since nothing is visible through full fog anyway.
+ *
+ * @param game Pointer to the game structure
+ * @return Distance in map cells, NO_RAY_LIMIT when unlimited
+ */
+double	max_ray_distance(const t_game *game)
+{
+	double	limit;
+
+	limit = NO_RAY_LIMIT;
+	if (game->max_ray_dist > 0)
+		limit = game->max_ray_dist;
+	if (game->shade.fog_dist > 0 && game->shade.fog_dist < limit)
+		limit = game->shade.fog_dist;
+	return (limit);
+}
+
+/**
+ * @brief Builds the ray result once the hit cell and side are known
+ *
+ * The perpendicular distance is computed in closed form from the grid
+ * line of the hit side, so it only depends on the ray direction, the
+ * hit cell and the side. This lets the span renderer fill columns
+ * without tracing them and still get exactly the same result.
+ *
+ * @param game Pointer to the game structure (player position)
+ * @param ray Ray with dir, step, side and hit cell (map_x, map_y) set
+ * @return t_ray_result for the ray
+ */
+t_ray_result	ray_hit_result(t_game *game, t_ray *ray)
+{
+	t_ray_result	result;
+
+	result.wall_dir = get_wall_direction(ray);
+	if (ray->far)
+		result.wall_dist = ray->max_dist;
+	else if (ray->side == VERTICAL_WALL)
+		result.wall_dist = (ray->map_x - game->player.pos_x
+				+ (1 - ray->step_x) / 2) / ray->dir_x;
+	else
+		result.wall_dist = (ray->map_y - game->player.pos_y
+				+ (1 - ray->step_y) / 2) / ray->dir_y;
+	result.wall_x = calculate_wall_x(ray, game->player.pos_x,
+			game->player.pos_y, result.wall_dist);
+	result.far = ray->far;
+	result.steps = ray->steps;
+	result.map_x = ray->map_x;
+	result.map_y = ray->map_y;
+	return (result);
+}
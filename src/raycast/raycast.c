@@ -6,127 +6,138 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:10:00 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:10:02 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:49:15 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
 /**
- * @brief Draws a vertical slice of pixels
+ * @brief Computes the drawing info of the wall column at screen position x
  *
- * @param game Pointer to game structure
- * @param x Column position
- * @param start Starting Y coordinate
- * @param end Ending Y coordinate
- * @param color Color to draw
- */
-static void	draw_column_slice(t_game *game, t_col column)
-{
-	int	y;
-
-	y = column.start;
-	while (y <= column.end)
-	{
-		draw_pixel_in_buffer(game, column.x, y, column.color);
-		y++;
-	}
-}
-
-/**
- * @brief Draws a complete column with ceiling, wall, and floor
- *
- * Draws ceiling and floor as solid colors, wall with textures.
- * Uses draw_column_slice for ceiling/floor and draw_textured_wall_slice
- * for the wall portion.
- *
- * @param game Pointer to game structure
- * @param info Drawing info containing positions, colors, wall_dir, and wall_x
- */
-static void	draw_full_column(t_game *game, t_draw_info info)
-{
-	t_col	col;
-
-	col.x = info.x;
-	col.start = 0;
-	col.end = info.draw_start - 1;
-	col.color = info.ceiling;
-	draw_column_slice(game, col);
-	draw_textured_wall_slice(game, info);
-	col.start = info.draw_end + 1;
-	col.end = WINDOWS_Y - 1;
-	col.color = info.floor;
-	draw_column_slice(game, col);
-}
-
-/**
- * @brief Draws a vertical wall column at screen position x
- *
- * Renders a complete vertical slice: ceiling, wall, and floor.
- * Clamps to screen bounds to prevent out-of-bounds writes.
+ * Works out the wall slice height and screen span from the ray result,
+ * for the drawing pass. Clamps to screen bounds to prevent out-of-bounds
+ * writes. A wall is at least one pixel high, however far it is: the
+ * texture step divides by the slice height.
  *
  * @param game Pointer to the game structure
- * @param x Screen column position (0 to WINDOWS_X-1)
+ * @param x Screen column position (0 to frame width - 1)
  * @param result Ray result containing wall distance, direction, and hit
  * position
+ * @return Drawing info of the column
  */
-static void	draw_wall_column(t_game *game, int x, t_ray_result result)
+t_draw_info	wall_column_info(t_game *game, int x, t_ray_result result)
 {
 	int			line_height;
-	int			draw_start;
-	int			draw_end;
 	t_draw_info	info;
 
 	if (result.wall_dist < MIN_WALL_DISTANCE)
 		result.wall_dist = MIN_WALL_DISTANCE;
-	line_height = (int)(WINDOWS_Y / result.wall_dist);
-	draw_start = (WINDOWS_Y - line_height) / 2;
-	draw_end = draw_start + line_height - 1;
-	if (draw_start < 0)
-		draw_start = 0;
-	if (draw_end >= WINDOWS_Y)
-		draw_end = WINDOWS_Y - 1;
+	line_height = (int)(game->frame.height / result.wall_dist);
+	if (line_height < 1)
+		line_height = 1;
+	info.draw_start = (game->frame.height - line_height) / 2;
+	info.draw_end = info.draw_start + line_height - 1;
+	if (info.draw_start < 0)
+		info.draw_start = 0;
+	if (info.draw_end >= game->frame.height)
+		info.draw_end = game->frame.height - 1;
 	info.x = x;
-	info.draw_start = draw_start;
-	info.draw_end = draw_end;
 	info.line_height = line_height;
-	info.ceiling = rgb_tab_to_int(game->map.ceiling_color);
-	info.floor = rgb_tab_to_int(game->map.floor_color);
 	info.wall_dir = result.wall_dir;
 	info.wall_x = result.wall_x;
-	draw_full_column(game, info);
+	info.wall_dist = result.wall_dist;
+	info.far = result.far;
+	info.map_x = result.map_x;
+	info.map_y = result.map_y;
+	return (info);
 }
 
 /**
- * @brief Casts a single ray for one screen column and renders it
+ * @brief Casts a single ray for one screen column
  *
- * Converts screen column x to camera space (-1.0 to +1.0),
+ * Looks up the camera space position of column x (-1.0 to +1.0),
  * calculates ray direction using linear algebra, performs raycasting via DDA
- * to find wall distance and direction, then delegates drawing to
- * draw_wall_column.
+ * to find wall distance and direction, then records the column with
+ * wall_column_info() into game->frame.columns.
  *
  * @param game Pointer to the game structure
- * @param x Screen column index (0 to WINDOWS_X-1)
+ * @param x Screen column index (0 to frame width - 1)
  */
-static void	cast_column_ray(t_game *game, int x)
+void	cast_column_ray(t_game *game, int x)
 {
 	double			camera_x;
 	double			ray_dir_x;
 	double			ray_dir_y;
 	t_ray_result	result;
 
-	camera_x = 2.0 * x / WINDOWS_X - 1.0;
+	camera_x = game->frame.camera_x[x];
 	ray_dir_x = game->player.dir_x + game->player.plane_x * camera_x;
 	ray_dir_y = game->player.dir_y + game->player.plane_y * camera_x;
 	result = cast_ray(game, ray_dir_x, ray_dir_y);
-	draw_wall_column(game, x, result);
+	game->frame.dda_steps += result.steps;
+	game->frame.columns[x] = wall_column_info(game, x, result);
+}
+
+/**
+ * @brief Draws a column whose ray passed the maximum ray distance
+ *
+ * No wall was found in range, so the slice a wall at that distance
+ * would cover is filled with the sky (ceiling) color, seen through the
+ * fog at that distance when fog is on. When the limit is the fog
+ * distance itself this is plain fog color.
+ *
+ * @param game Pointer to the game structure
+ * @param info Drawing info of the column (wall_dist = the limit)
+ */
+static void	draw_far_column(t_game *game, t_draw_info info)
+{
+	const unsigned char	*shade;
+	unsigned int		color;
+	unsigned int		*dst;
+	int					y;
+
+	color = (unsigned int)game->map.ceiling_rgb;
+	shade = shade_lut(&game->shade, info.wall_dist);
+	if (shade)
+		color = shade_pixel(shade, color);
+	dst = game->frame.pixels + info.x;
+	y = info.draw_start;
+	while (y <= info.draw_end)
+	{
+		dst[y * game->frame.stride] = color;
+		y++;
+	}
+}
+
+/**
+ * @brief Draws one recorded column over the background
+ *
+ * @param game Pointer to the game structure
+ * @param info Drawing info of the column
+ */
+void	draw_column(t_game *game, t_draw_info info)
+{
+	if (info.far)
+		draw_far_column(game, info);
+	else
+		draw_textured_wall_slice(game, info);
 }
 
 /**
  * @brief Renders a complete frame with full raycasting
  *
- * Main rendering loop that casts one ray per screen column
- * (WINDOWS_X rays total).
+ * Renders in three passes:
+ *   1. Wall pass - casts one ray per column of the render target
+ *      (game->frame.width rays total) and records each wall slice, or
+ *      with --spans only traces the columns cast_spans() needs
+ *   2. Background - ceiling and floor, filled row by row
+ *   3. Column pass - draw_walls() draws only the wall slices over the
+ *      background, or the sky/fog color for rays that found no wall in
+ *      range, supersampling edge columns with --aa
+ * frame.dda_steps counts the DDA steps of the wall and column passes.
+ * With dynamic resolution scaling the frame can be narrower than the
+ * window.
  *
  * @param game Pointer to the game structure
  */
@@ -134,10 +145,15 @@ void	render_frame(t_game *game)
 {
 	int		x;
 
+	game->frame.dda_steps = 0;
 	x = 0;
-	while (x < WINDOWS_X)
+	while (x < game->frame.width && !game->span_mode)
 	{
 		cast_column_ray(game, x);
 		x++;
 	}
+	if (game->span_mode)
+		cast_spans(game);
+	draw_background(game);
+	draw_walls(game);
 }
@@ -6,7 +6,7 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 14:09:49 by diade-so          #+#    #+#             */
-/*   Updated: 2025/12/27 14:09:52 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:38:37 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,82 +15,144 @@
 /**
  * @brief Converts wall hit position to texture column coordinate
  *
- * Maps wall_x (0.0 to 1.0) to texture column (0 to TEXTURE_WIDTH-1).
+ * Maps wall_x (0.0 to 1.0) to texture column (0 to tex_width-1).
  * Clamps to valid range to handle floating point edge case where
  * wall_x might equal exactly 1.0 due to precision.
  *
  * @param wall_x Wall hit position as fractional value (0.0 to 1.0)
- * @return Texture X coordinate (0 to TEXTURE_WIDTH-1)
+ * @param tex_width Width of the texture (or mip level) being sampled
+ * @return Texture X coordinate (0 to tex_width-1)
  */
-int	calculate_tex_x(double wall_x)
+int	calculate_tex_x(double wall_x, int tex_width)
 {
 	int	tex_x;
 
-	tex_x = (int)(wall_x * TEXTURE_WIDTH);
-	if (tex_x >= TEXTURE_WIDTH)
-		tex_x = TEXTURE_WIDTH - 1;
+	tex_x = (int)(wall_x * tex_width);
+	if (tex_x >= tex_width)
+		tex_x = tex_width - 1;
 	return (tex_x);
 }
 
 /**
- * @brief Retrieves a pixel color from a texture at given coordinates
+ * @brief Picks the mip level to sample for a wall slice
  *
- * Performs boundary checks before memory access to prevent segfaults.
- * Uses MLX texture memory layout: offset = y * line_len + x * (bpp/8)
+ * Takes the smallest level that is still at least as tall as the slice
+ * on screen, so each screen pixel steps over at most two texels. Near
+ * walls (line_height >= texture height) always use the full texture.
  *
- * MLX stores pixels as 32-bit integers in 0xAARRGGBB format:
- * - Casting char* to int* reads 4 bytes at once (ARGB components)
- * - Returns the complete color value as a single integer
+ * @param texture Wall texture with its mip chain built
+ * @param line_height Height of the wall slice in pixels
+ * @return Pointer to the selected level
+ */
+t_mip	*select_mip(t_texture *texture, int line_height)
+{
+	int	level;
+
+	level = 0;
+	while (level + 1 < texture->mip_count
+		&& texture->mips[level + 1].height >= line_height)
+		level++;
+	return (&texture->mips[level]);
+}
+
+/**
+ * @brief Sets up the unshaded span of a wall slice in a mip level
+ *
+ * Maps screen Y coordinates to texture Y coordinates with a 16.16 fixed
+ * point step/tex_pos, which handles walls of any height, including
+ * those extending beyond screen. The step is based on the actual wall
+ * height to prevent texture squishing.
  *
- * @param texture Pointer to the texture structure
- * @param tex_x X coordinate in texture (0 to width-1)
- * @param tex_y Y coordinate in texture (0 to height-1)
- * @return Pixel color in 0xAARRGGBB format, or TEXTURE_FALLBACK_COLOR
- * if out of bounds
+ * @param frame Render target
+ * @param info Drawing info of the column
+ * @param mip Level to sample
+ * @return Span drawing the slice with the level's own palette, unshaded
  */
-int	get_texture_pixel(t_texture *texture, int tex_x, int tex_y)
+static t_span	setup_wall_span(const t_frame *frame, const t_draw_info *info,
+		const t_mip *mip)
 {
-	char	*pixel;
+	t_span	span;
+
+	span.tex_x = calculate_tex_x(info->wall_x, mip->width);
+	span.step = ((long)mip->height << 16) / info->line_height;
+	span.pos = (info->draw_start - (frame->height - info->line_height) / 2)
+		* span.step;
+	span.dst = frame->pixels + info->draw_start * frame->stride + info->x;
+	span.dst_stride = frame->stride;
+	span.count = info->draw_end - info->draw_start + 1;
+	span.palette = mip->palette;
+	span.shade = NULL;
+	span.tex_fx = 0;
+	return (span);
+}
 
-	if (tex_x < 0 || tex_x >= texture->width)
-		return (TEXTURE_FALLBACK_COLOR);
-	if (tex_y < 0 || tex_y >= texture->height)
-		return (TEXTURE_FALLBACK_COLOR);
-	pixel = texture->addr + (tex_y * texture->line_len + tex_x
-			* (texture->bpp / 8));
-	return (*(int *)pixel);
+/**
+ * @brief Moves a wall span onto texel centers for bilinear filtering
+ *
+ * Picks the left texel column and the weight of its right neighbour,
+ * and shifts the 16.16 row position by half a texel, so each screen
+ * pixel blends the four texels around its center.
+ *
+ * @param span Span set up by setup_wall_span()
+ * @param wall_x Wall hit position (0.0 to 1.0)
+ * @param mip Level to sample (see can_filter_bilinear())
+ * @return Span for sample_wall_bilinear()
+ */
+static t_span	bilinear_span(t_span span, double wall_x, const t_mip *mip)
+{
+	double	u;
+
+	u = wall_x * mip->width - 0.5;
+	if (u < 0)
+		u = 0;
+	span.tex_x = (int)u;
+	span.tex_fx = (int)((u - span.tex_x) * 256);
+	if (span.tex_x >= mip->width - 1)
+	{
+		span.tex_x = mip->width - 2;
+		span.tex_fx = 256;
+	}
+	span.pos += span.step / 2 - 0x8000;
+	return (span);
 }
 
 /**
  * @brief Draws a textured wall column slice
  *
- * Maps screen Y coordinates to texture Y coordinates and samples
- * the texture for each pixel. Uses the step/tex_pos algorithm to
- * handle walls of any height, including those extending beyond screen.
- * Calculates step based on actual wall height to prevent texture squishing.
+ * Distant walls sample a smaller mip level (see select_mip), and the
+ * level's own sampler, chosen when the texture was loaded (see
+ * set_wall_sampler), writes the span. With fog on, the fog level is
+ * picked once for the column from its wall distance: palettised
+ * textures swap in the matching fogged palette, the others go through
+ * the level's channel tables (sample_shaded). With bilinear filtering
+ * on (--bilinear, toggled with B), 32-bit levels are drawn by
+ * sample_wall_bilinear() instead.
  *
  * @param game Pointer to game structure
  * @param info Drawing info containing x, draw range, line_height, wall_dir,
- * wall_x
+ * wall_x and wall_dist
  */
 void	draw_textured_wall_slice(t_game *game, t_draw_info info)
 {
-	int		tex_x;
-	int		tex_y;
-	double	step;
-	double	tex_pos;
-	int		y;
+	t_texture	*tex;
+	t_mip		*mip;
+	t_span		span;
+	int			level;
 
-	tex_x = calculate_tex_x(info.wall_x);
-	step = (double)TEXTURE_HEIGHT / info.line_height;
-	tex_pos = (info.draw_start - (WINDOWS_Y - info.line_height) / 2) * step;
-	y = info.draw_start;
-	while (y <= info.draw_end)
+	tex = &game->textures[info.wall_dir];
+	mip = select_mip(tex, info.line_height);
+	span = setup_wall_span(&game->frame, &info, mip);
+	level = shade_level(&game->shade, info.wall_dist);
+	if (level > 0)
+		span.shade = game->shade.lut[level];
+	if (game->bilinear && can_filter_bilinear(mip))
+		sample_wall_bilinear(bilinear_span(span, info.wall_x, mip), mip);
+	else if (level == 0)
+		mip->sample(span, mip);
+	else
 	{
-		tex_y = (int)tex_pos;
-		draw_pixel_in_buffer(game, info.x, y,
-			get_texture_pixel(&game->textures[info.wall_dir], tex_x, tex_y));
-		tex_pos += step;
-		y++;
+		if (tex->shaded_palettes)
+			span.palette = tex->shaded_palettes + level * PALETTE_SIZE;
+		mip->sample_shaded(span, mip);
 	}
 }
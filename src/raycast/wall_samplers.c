@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_samplers.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:07:52 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:36:10 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Draws a wall span from a power of two texture level (scalar)
+ *
+ * The texture row is the integer part of the 16.16 position, wrapped
+ * with a mask, and the row offset is a shift instead of a multiply.
+ *
+ * @param span Destination pixels, texture column and 16.16 position/step
+ * @param mip Level being sampled (row_mask and row_shift set)
+ */
+void	sample_wall_nearest_scalar(t_span span, const t_mip *mip)
+{
+	const unsigned int	*column;
+
+	column = mip->pixels + span.tex_x;
+	while (span.count > 0)
+	{
+		*span.dst = column[((span.pos >> 16) & mip->row_mask)
+			<< mip->row_shift];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
+
+/**
+ * @brief Draws a wall span from a texture level of any size
+ *
+ * Same loop as sample_wall_nearest_scalar() but clamps the row and
+ * multiplies by the stride, for heights or strides that are not powers
+ * of two.
+ *
+ * @param span Destination pixels, texture column and 16.16 position/step
+ * @param mip Level being sampled
+ */
+static void	sample_wall_generic(t_span span, const t_mip *mip)
+{
+	const unsigned int	*column;
+	long				row;
+
+	column = mip->pixels + span.tex_x;
+	while (span.count > 0)
+	{
+		row = span.pos >> 16;
+		if (row >= mip->height)
+			row = mip->height - 1;
+		*span.dst = column[row * mip->stride];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
+
+/**
+ * @brief Returns log2(n) if n is a power of two, -1 otherwise
+ *
+ * @param n Value to check
+ * @return Exponent, or -1 if n is not a power of two
+ */
+static int	pow2_shift(int n)
+{
+	int	shift;
+
+	if (n <= 0 || (n & (n - 1)) != 0)
+		return (-1);
+	shift = 0;
+	while ((1 << shift) < n)
+		shift++;
+	return (shift);
+}
+
+/**
+ * @brief Checks if a texture level can be sampled with bilinear filtering
+ *
+ * Palettised levels and levels narrower or shorter than two texels
+ * keep their nearest neighbour sampler.
+ *
+ * @param mip Texture level
+ * @return true if sample_wall_bilinear() can draw from it
+ */
+bool	can_filter_bilinear(const t_mip *mip)
+{
+	return (!mip->indices && mip->width > 1 && mip->height > 1);
+}
+
+/**
+ * @brief Chooses the wall sampler of a texture level, once at load time
+ *
+ * Levels whose height and stride are both powers of two get a
+ * shift/mask sampler, from the active kernels (sample_wall_nearest()),
+ * every other size a generic one. Palettised
+ * levels (indices set) get the matching palette sampler. The fogged
+ * variant (sample_shaded) of a palettised level is the same sampler,
+ * fed a fogged palette instead.
+ *
+ * @param mip Level with width, height, stride and storage set
+ */
+void	set_wall_sampler(t_mip *mip)
+{
+	bool	pow2;
+
+	mip->row_shift = pow2_shift(mip->stride);
+	mip->row_mask = mip->height - 1;
+	pow2 = (mip->row_shift >= 0 && pow2_shift(mip->height) >= 0);
+	if (mip->indices && pow2)
+		mip->sample = sample_wall_palette_pow2;
+	else if (mip->indices)
+		mip->sample = sample_wall_palette_generic;
+	else if (pow2)
+		mip->sample = sample_wall_nearest;
+	else
+		mip->sample = sample_wall_generic;
+	mip->sample_shaded = mip->sample;
+	if (!mip->indices && pow2)
+		mip->sample_shaded = sample_wall_shaded_pow2;
+	else if (!mip->indices)
+		mip->sample_shaded = sample_wall_shaded_generic;
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_samplers_avx2.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:35:34 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:35:34 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+#ifdef __AVX2__
+# include <immintrin.h>
+
+/**
+ * @brief Gets the texel offsets of eight 16.16 positions (AVX2)
+ *
+ * Same row as the scalar sampler, ((pos >> 16) & row_mask) << row_shift,
+ * on the low 32 bits of each position: the mask only keeps bits 16 to
+ * 31, which the truncation leaves exact.
+ *
+ * @param pos Low 32 bits of eight positions
+ * @param mip Level being sampled (row_mask below 65536)
+ * @return Offsets of the texels in the column
+ */
+static __m256i	texel_offsets(__m256i pos, const t_mip *mip)
+{
+	return (_mm256_sll_epi32(_mm256_and_si256(_mm256_srli_epi32(pos, 16),
+				_mm256_set1_epi32(mip->row_mask)),
+			_mm_cvtsi32_si128(mip->row_shift)));
+}
+
+/**
+ * @brief Draws a wall span from a power of two texture level, eight
+ *        texels per gather (AVX2)
+ *
+ * The frame pixels of a span are a column apart, so the texels are
+ * gathered eight at a time and stored one per frame row. The last
+ * pixels, and levels of 65536 rows or more, go through the scalar
+ * sampler.
+ *
+ * @param span Destination pixels, texture column and 16.16 position/step
+ * @param mip Level being sampled (row_mask and row_shift set)
+ */
+void	sample_wall_nearest_avx2(t_span span, const t_mip *mip)
+{
+	__m256i			pos;
+	unsigned int	px[8];
+	int				i;
+
+	pos = _mm256_add_epi32(_mm256_set1_epi32((int)span.pos),
+			_mm256_mullo_epi32(_mm256_set1_epi32((int)span.step),
+				_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+	while (span.count >= 8 && mip->row_mask <= 0xFFFF)
+	{
+		_mm256_storeu_si256((__m256i *)px, _mm256_i32gather_epi32(
+				(const int *)(mip->pixels + span.tex_x),
+				texel_offsets(pos, mip), 4));
+		i = -1;
+		while (++i < 8)
+		{
+			*span.dst = px[i];
+			span.dst += span.dst_stride;
+		}
+		pos = _mm256_add_epi32(pos, _mm256_set1_epi32((int)(8 * span.step)));
+		span.pos += 8 * span.step;
+		span.count -= 8;
+	}
+	sample_wall_nearest_scalar(span, mip);
+}
+
+#endif
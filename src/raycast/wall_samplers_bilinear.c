@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_samplers_bilinear.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:34:00 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:34:00 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Blends two pixels, two channels per 32-bit multiply
+ *
+ * @param a First pixel
+ * @param b Second pixel
+ * @param f Weight of b, 0 to 256
+ * @return Blended pixel
+ */
+static unsigned int	lerp_pixel(unsigned int a, unsigned int b, int f)
+{
+	unsigned int	rb;
+	unsigned int	ag;
+
+	rb = (((a & 0xFF00FF) * (256 - f) + (b & 0xFF00FF) * f) >> 8) & 0xFF00FF;
+	ag = (((a >> 8) & 0xFF00FF) * (256 - f) + ((b >> 8) & 0xFF00FF) * f)
+		& 0xFF00FF00;
+	return (rb | ag);
+}
+
+/**
+ * @brief Blends the texel pairs of texture row and of the row below
+ *
+ * Rows are clamped to the texture, never wrapped, so the top and bottom
+ * of a wall do not bleed into each other.
+ *
+ * @param rows Receives the blended upper and lower rows
+ * @param mip Level being sampled
+ * @param span Span giving the texel column and its right weight
+ * @param row Upper texture row, may be -1 at the top of the wall
+ */
+static void	blend_rows(unsigned int *rows, const t_mip *mip,
+		const t_span *span, long row)
+{
+	const unsigned int	*texel;
+	long				next;
+
+	next = row + 1;
+	if (next >= mip->height)
+		next = mip->height - 1;
+	if (row < 0)
+		row = 0;
+	texel = mip->pixels + row * mip->stride + span->tex_x;
+	rows[0] = lerp_pixel(texel[0], texel[1], span->tex_fx);
+	texel = mip->pixels + next * mip->stride + span->tex_x;
+	rows[1] = lerp_pixel(texel[0], texel[1], span->tex_fx);
+}
+
+/**
+ * @brief Draws a wall span with bilinear filtering (scalar)
+ *
+ * The four texels around each pixel are blended in two steps: the two
+ * texels of each row, then the two rows. The column is fixed for the
+ * whole span, so the row blends are only redone when the span moves to
+ * a new texture row, which on magnified walls is once every few pixels.
+ * Fog, if any, is applied to the blended pixel. The SIMD variants give
+ * the same result.
+ *
+ * @param span Span set up for bilinear sampling
+ * @param mip Level being sampled (32-bit pixels)
+ */
+void	sample_wall_bilinear_scalar(t_span span, const t_mip *mip)
+{
+	unsigned int	rows[2];
+	long			cached;
+
+	cached = span.pos >> 16;
+	blend_rows(rows, mip, &span, cached);
+	while (span.count-- > 0)
+	{
+		if (span.pos >> 16 != cached)
+		{
+			cached = span.pos >> 16;
+			blend_rows(rows, mip, &span, cached);
+		}
+		*span.dst = lerp_pixel(rows[0], rows[1], (span.pos >> 8) & 0xFF);
+		if (span.shade)
+			*span.dst = shade_pixel(span.shade, *span.dst);
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+	}
+}
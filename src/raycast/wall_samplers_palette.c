@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_samplers_palette.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:13:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:22:03 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Draws a wall span from a palettised power of two texture level
+ *
+ * Reads one byte per texel and resolves it through a 1 KB color table,
+ * which stays in L1 for the whole span. The table is the texture's own
+ * palette, or one of its fogged copies (see build_shaded_palettes()),
+ * so fog costs nothing extra per pixel here.
+ *
+ * @param span Destination pixels, texture column, 16.16 position/step
+ *             and color table
+ * @param mip Level being sampled (indices, row_mask and row_shift set)
+ */
+void	sample_wall_palette_pow2(t_span span, const t_mip *mip)
+{
+	const unsigned char	*column;
+	const unsigned int	*palette;
+
+	column = mip->indices + span.tex_x;
+	palette = span.palette;
+	while (span.count > 0)
+	{
+		*span.dst = palette[column[((span.pos >> 16) & mip->row_mask)
+				<< mip->row_shift]];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
+
+/**
+ * @brief Draws a wall span from a palettised texture level of any size
+ *
+ * @param span Destination pixels, texture column, 16.16 position/step
+ *             and color table
+ * @param mip Level being sampled (indices set)
+ */
+void	sample_wall_palette_generic(t_span span, const t_mip *mip)
+{
+	const unsigned char	*column;
+	const unsigned int	*palette;
+	long				row;
+
+	column = mip->indices + span.tex_x;
+	palette = span.palette;
+	while (span.count > 0)
+	{
+		row = span.pos >> 16;
+		if (row >= mip->height)
+			row = mip->height - 1;
+		*span.dst = palette[column[row * mip->stride]];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
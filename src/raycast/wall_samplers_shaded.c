@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_samplers_shaded.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:19:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:19:13 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Draws a fogged wall span from a power of two texture level
+ *
+ * Same walk as the unshaded sampler; each texel then goes through the
+ * column's fog level tables (span.shade), three byte lookups that stay
+ * in L1 for the whole span.
+ *
+ * @param span Destination pixels, texture column, 16.16 position/step
+ *             and shade tables
+ * @param mip Level being sampled (row_mask and row_shift set)
+ */
+void	sample_wall_shaded_pow2(t_span span, const t_mip *mip)
+{
+	const unsigned int	*column;
+	unsigned int		texel;
+
+	column = mip->pixels + span.tex_x;
+	while (span.count > 0)
+	{
+		texel = column[((span.pos >> 16) & mip->row_mask) << mip->row_shift];
+		*span.dst = (texel & 0xFF000000)
+			| (unsigned int)span.shade[(texel >> 16) & 0xFF] << 16
+			| (unsigned int)span.shade[256 + ((texel >> 8) & 0xFF)] << 8
+			| (unsigned int)span.shade[512 + (texel & 0xFF)];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
+
+/**
+ * @brief Draws a fogged wall span from a texture level of any size
+ *
+ * @param span Destination pixels, texture column, 16.16 position/step
+ *             and shade tables
+ * @param mip Level being sampled
+ */
+void	sample_wall_shaded_generic(t_span span, const t_mip *mip)
+{
+	const unsigned int	*column;
+	unsigned int		texel;
+	long				row;
+
+	column = mip->pixels + span.tex_x;
+	while (span.count > 0)
+	{
+		row = span.pos >> 16;
+		if (row >= mip->height)
+			row = mip->height - 1;
+		texel = column[row * mip->stride];
+		*span.dst = (texel & 0xFF000000)
+			| (unsigned int)span.shade[(texel >> 16) & 0xFF] << 16
+			| (unsigned int)span.shade[256 + ((texel >> 8) & 0xFF)] << 8
+			| (unsigned int)span.shade[512 + (texel & 0xFF)];
+		span.dst += span.dst_stride;
+		span.pos += span.step;
+		span.count--;
+	}
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   background.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:59:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:41:56 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Fills the screen rows [start, end) of the frame with one color
+ *
+ * With fog on, each row is shaded by the distance of the floor or
+ * ceiling it shows, once per row (see row_distance()).
+ *
+ * @param game Pointer to game structure
+ * @param start First row to fill
+ * @param end Row after the last one to fill
+ * @param color Packed pixel color
+ */
+static void	fill_rows(t_game *game, int start, int end, int color)
+{
+	const unsigned char	*shade;
+	unsigned int		row_color;
+
+	while (start < end)
+	{
+		row_color = (unsigned int)color;
+		shade = shade_lut(&game->shade, row_distance(&game->frame, start));
+		if (shade)
+			row_color = shade_pixel(shade, row_color);
+		fill_row(game->frame.pixels + start * game->frame.stride, row_color,
+			game->frame.width);
+		start++;
+	}
+}
+
+/**
+ * @brief Lays down the ceiling and floor before the walls are drawn
+ *
+ * A flat ceiling fills every row above the horizon and a flat floor
+ * every row below it, as contiguous row fills instead of one pixel at
+ * a time per column. Textured surfaces are floor cast row by row by
+ * draw_floor_ceiling(). The wall slices are then drawn on top, so the
+ * column pass only writes the wall span.
+ *
+ * @param game Pointer to game structure
+ */
+void	draw_background(t_game *game)
+{
+	int	horizon;
+
+	horizon = game->frame.height / 2;
+	if (!surface_is_textured(game, ID_CEILING))
+		fill_rows(game, 0, horizon, game->map.ceiling_rgb);
+	if (!surface_is_textured(game, ID_FLOOR))
+		fill_rows(game, horizon, game->frame.height, game->map.floor_rgb);
+	if (surface_is_textured(game, ID_FLOOR)
+		|| surface_is_textured(game, ID_CEILING))
+		draw_floor_ceiling(game);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   floor_casting.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:57:16 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:22:03 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Converts the fractional part of a value to 0.32 fixed point
+ *
+ * Floor and ceiling textures repeat on every map cell, so only the
+ * position inside the cell matters. Keeping just the fraction lets
+ * the per-pixel step wrap around with plain unsigned overflow, and
+ * negative values wrap to the matching positive fraction.
+ *
+ * @param value Map space coordinate or step
+ * @return Fractional part scaled to the full unsigned 32-bit range
+ */
+static unsigned int	to_fixed(double value)
+{
+	return ((unsigned int)(long)((value - floor(value)) * 4294967296.0));
+}
+
+/**
+ * @brief Computes the texture coordinates of one floor row
+ *
+ * Every pixel of a screen row below the horizon sees the floor at the
+ * same distance, so the distance is computed once per row and the map
+ * position then moves linearly from the leftmost ray (dir - plane) to
+ * the rightmost ray (dir + plane). The ceiling row mirrored above the
+ * horizon is at the same distance and reuses these coordinates, and
+ * the same fog level.
+ *
+ * @param game Pointer to game structure
+ * @param y Screen row, at or below the horizon
+ * @param row Output start position, per-pixel step and shade tables
+ */
+static void	setup_floor_row(t_game *game, int y, t_floor_row *row)
+{
+	t_player	*p;
+	double		row_dist;
+
+	p = &game->player;
+	row_dist = row_distance(&game->frame, y);
+	row->u = to_fixed(p->pos_x + row_dist * (p->dir_x - p->plane_x));
+	row->v = to_fixed(p->pos_y + row_dist * (p->dir_y - p->plane_y));
+	row->step_u = to_fixed(row_dist * 2.0 * p->plane_x / game->frame.width);
+	row->step_v = to_fixed(row_dist * 2.0 * p->plane_y / game->frame.width);
+	row->shade = shade_lut(&game->shade, row_dist);
+}
+
+/**
+ * @brief Fills one screen row with a floor or ceiling texture
+ *
+ * The inner loop is integer only: texel coordinates are the high bits
+ * of the fixed point position scaled by the texture size, and the
+ * position advances by a constant step per pixel. Fogged rows go
+ * through the row's channel tables.
+ *
+ * @param tex Full size level of the texture to sample
+ * @param dst First pixel of the destination row
+ * @param row Start position, per-pixel step and shade tables (or NULL)
+ * @param width Number of pixels to fill
+ */
+static void	draw_surface_row(const t_mip *tex, unsigned int *dst,
+		t_floor_row row, int width)
+{
+	unsigned int	tex_x;
+	unsigned int	tex_y;
+	unsigned int	texel;
+	int				x;
+
+	x = 0;
+	while (x < width)
+	{
+		tex_x = ((unsigned long)row.u * tex->width) >> 32;
+		tex_y = ((unsigned long)row.v * tex->height) >> 32;
+		texel = tex->pixels[tex_y * tex->stride + tex_x];
+		if (row.shade)
+			texel = shade_pixel(row.shade, texel);
+		dst[x] = texel;
+		row.u += row.step_u;
+		row.v += row.step_v;
+		x++;
+	}
+}
+
+/**
+ * @brief Checks if the floor or ceiling uses a texture
+ *
+ * @param game Pointer to game structure
+ * @param id ID_FLOOR or ID_CEILING
+ * @return true if a texture was loaded for that surface, false if it is
+ *         a flat color
+ */
+bool	surface_is_textured(t_game *game, t_header_type id)
+{
+	return (game->textures[id].mip_count > 0);
+}
+
+/**
+ * @brief Draws the textured floor and ceiling, one screen row at a time
+ *
+ * Called by draw_background() before the walls are drawn, so the wall
+ * slices are simply drawn over the rows. Each floor row y is paired
+ * with the ceiling row mirrored around the horizon. Surfaces using a
+ * flat color are skipped, they were already filled.
+ *
+ * @param game Pointer to game structure
+ */
+void	draw_floor_ceiling(t_game *game)
+{
+	t_floor_row	row;
+	t_frame		*frame;
+	int			y;
+
+	frame = &game->frame;
+	y = frame->height / 2;
+	while (y < frame->height)
+	{
+		setup_floor_row(game, y, &row);
+		if (surface_is_textured(game, ID_FLOOR))
+			draw_surface_row(&game->textures[ID_FLOOR].mips[0],
+				frame->pixels + y * frame->stride, row, frame->width);
+		if (surface_is_textured(game, ID_CEILING))
+			draw_surface_row(&game->textures[ID_CEILING].mips[0],
+				frame->pixels + (frame->height - 1 - y) * frame->stride, row,
+				frame->width);
+		y++;
+	}
+}
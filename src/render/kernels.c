@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernels.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:40:46 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:36:10 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Gets the kernel table of an instruction set
+ *
+ * There is no AVX-512 table: the row kernels are bound by memory on a
+ * whole frame and gained nothing over AVX2.
+ *
+ * @param isa Instruction set
+ * @param out Table to fill, or NULL to only check that it exists
+ * @return true if the kernels of isa are built in
+ */
+bool	kernel_table(t_isa isa, t_kernels *out)
+{
+	if (isa == ISA_SSE2)
+		return (sse2_kernels(out));
+	if (isa == ISA_AVX2)
+		return (avx2_kernels(out));
+	if (out)
+		*out = (t_kernels){ISA_SCALAR, fill_row_scalar, copy_row_scalar,
+			upscale_row_2x_scalar, sample_wall_bilinear_scalar,
+			sample_wall_nearest_scalar};
+	return (isa == ISA_SCALAR);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/**
+ * @brief Checks with cpuid if this CPU can run an instruction set
+ *
+ * cpuid is checked first: the AVX2 files are built with AVX2 enabled,
+ * so nothing in them may run before.
+ *
+ * @param isa Instruction set
+ * @return true if the kernels of isa are built in and the CPU runs them
+ */
+bool	isa_supported(t_isa isa)
+{
+	__builtin_cpu_init();
+	if (isa == ISA_SSE2 && !__builtin_cpu_supports("sse2"))
+		return (false);
+	if (isa == ISA_AVX2 && !__builtin_cpu_supports("avx2"))
+		return (false);
+	return (kernel_table(isa, NULL));
+}
+
+#else
+
+/**
+ * @brief Checks if this CPU can run an instruction set (non x86 build)
+ *
+ * @param isa Instruction set
+ * @return true for the scalar kernels only
+ */
+bool	isa_supported(t_isa isa)
+{
+	return (isa == ISA_SCALAR);
+}
+
+#endif
+
+/**
+ * @brief Returns the command line name of an instruction set
+ *
+ * @param isa Instruction set, or ISA_COUNT
+ * @return "scalar", "sse2", "avx2", or NULL for ISA_COUNT
+ */
+const char	*isa_name(t_isa isa)
+{
+	static const char	*names[ISA_COUNT + 1] = {"scalar", "sse2", "avx2",
+		NULL};
+
+	return (names[isa]);
+}
+
+/**
+ * @brief Returns the active render kernels
+ *
+ * On first use, picks the widest instruction set the CPU supports, so
+ * the cpuid checks run once per run and every later call is a plain
+ * lookup. --force-isa overrides the choice (see parse_isa()).
+ *
+ * @return Active kernel table
+ */
+t_kernels	*kernels(void)
+{
+	static t_kernels	active;
+	t_isa				isa;
+
+	if (active.fill_row)
+		return (&active);
+	isa = ISA_COUNT - 1;
+	while (isa > ISA_SCALAR && !isa_supported(isa))
+		isa--;
+	kernel_table(isa, &active);
+	return (&active);
+}
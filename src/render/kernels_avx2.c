@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernels_avx2.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:40:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:35:19 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+#ifdef __AVX2__
+# include <immintrin.h>
+
+/**
+ * @brief Fills a row of pixels with one color, 8 pixels per store (AVX2)
+ *
+ * @param dst First pixel of the row
+ * @param color Packed pixel color
+ * @param n Number of pixels
+ */
+void	fill_row_avx2(unsigned int *dst, unsigned int color, int n)
+{
+	__m256i	px;
+	int		x;
+
+	px = _mm256_set1_epi32((int)color);
+	x = 0;
+	while (x + 8 <= n)
+	{
+		_mm256_storeu_si256((__m256i *)(dst + x), px);
+		x += 8;
+	}
+	fill_row_scalar(dst + x, color, n - x);
+}
+
+/**
+ * @brief Copies a row of pixels, 8 pixels per store (AVX2)
+ *
+ * @param dst Destination row
+ * @param src Source row (must not overlap dst)
+ * @param n Number of pixels
+ */
+void	copy_row_avx2(unsigned int *dst, const unsigned int *src, int n)
+{
+	int	x;
+
+	x = 0;
+	while (x + 8 <= n)
+	{
+		_mm256_storeu_si256((__m256i *)(dst + x),
+			_mm256_loadu_si256((const __m256i *)(src + x)));
+		x += 8;
+	}
+	copy_row_scalar(dst + x, src + x, n - x);
+}
+
+/**
+ * @brief Doubles every pixel of a row (AVX2)
+ *
+ * Loads 8 pixels at a time and spreads each one over two lanes with a
+ * cross-lane permute, producing 16 output pixels per iteration.
+ *
+ * @param dst Destination row, at least 2 * src_w pixels
+ * @param src Source row
+ * @param src_w Number of source pixels
+ */
+void	upscale_row_2x_avx2(unsigned int *dst, const unsigned int *src,
+		int src_w)
+{
+	__m256i	px;
+	__m256i	lo;
+	__m256i	hi;
+	int		x;
+
+	lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+	hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+	x = 0;
+	while (x + 8 <= src_w)
+	{
+		px = _mm256_loadu_si256((const __m256i *)(src + x));
+		_mm256_storeu_si256((__m256i *)(dst + 2 * x),
+			_mm256_permutevar8x32_epi32(px, lo));
+		_mm256_storeu_si256((__m256i *)(dst + 2 * x + 8),
+			_mm256_permutevar8x32_epi32(px, hi));
+		x += 8;
+	}
+	upscale_row_2x_scalar(dst + 2 * x, src + x, src_w - x);
+}
+
+/**
+ * @brief Fills in the AVX2 kernel table
+ *
+ * The bilinear sampler stores one pixel per frame row and runs no faster
+ * on 256-bit vectors, so the table keeps the SSE2 one.
+ *
+ * @param k Table to fill, or NULL to only check that the kernels exist
+ * @return true, the AVX2 kernels are built in
+ */
+bool	avx2_kernels(t_kernels *k)
+{
+	if (k)
+		*k = (t_kernels){ISA_AVX2, fill_row_avx2, copy_row_avx2,
+			upscale_row_2x_avx2, sample_wall_bilinear_sse2,
+			sample_wall_nearest_avx2};
+	return (true);
+}
+
+#else
+
+/**
+ * @brief Reports that the AVX2 kernels are not built in
+ *
+ * @param k Unused
+ * @return false
+ */
+bool	avx2_kernels(t_kernels *k)
+{
+	(void)k;
+	return (false);
+}
+
+#endif
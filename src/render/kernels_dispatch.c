@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernels_dispatch.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:40:46 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:36:10 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Fills a row of pixels with one color (active kernels)
+ *
+ * @param dst First pixel of the row
+ * @param color Packed pixel color
+ * @param n Number of pixels
+ */
+void	fill_row(unsigned int *dst, unsigned int color, int n)
+{
+	kernels()->fill_row(dst, color, n);
+}
+
+/**
+ * @brief Copies a row of pixels (active kernels)
+ *
+ * @param dst Destination row
+ * @param src Source row (must not overlap dst)
+ * @param n Number of pixels
+ */
+void	copy_row(unsigned int *dst, const unsigned int *src, int n)
+{
+	kernels()->copy_row(dst, src, n);
+}
+
+/**
+ * @brief Doubles every pixel of a row (active kernels)
+ *
+ * @param dst Destination row, at least 2 * src_w pixels
+ * @param src Source row
+ * @param src_w Number of source pixels
+ */
+void	upscale_row_2x(unsigned int *dst, const unsigned int *src, int src_w)
+{
+	kernels()->upscale_row_2x(dst, src, src_w);
+}
+
+/**
+ * @brief Draws a wall span with bilinear filtering (active kernels)
+ *
+ * @param span Span set up for bilinear sampling
+ * @param mip Level being sampled (32-bit pixels)
+ */
+void	sample_wall_bilinear(t_span span, const t_mip *mip)
+{
+	kernels()->sample_wall_bilinear(span, mip);
+}
+
+/**
+ * @brief Draws a wall span from a power of two texture level (active
+ *        kernels)
+ *
+ * @param span Destination pixels, texture column and 16.16 position/step
+ * @param mip Level being sampled (row_mask and row_shift set)
+ */
+void	sample_wall_nearest(t_span span, const t_mip *mip)
+{
+	kernels()->sample_wall_nearest(span, mip);
+}
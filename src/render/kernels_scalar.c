@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernels_scalar.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:40:23 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:40:23 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Fills a row of pixels with one color (scalar)
+ *
+ * @param dst First pixel of the row
+ * @param color Packed pixel color
+ * @param n Number of pixels
+ */
+void	fill_row_scalar(unsigned int *dst, unsigned int color, int n)
+{
+	int	x;
+
+	x = 0;
+	while (x < n)
+	{
+		dst[x] = color;
+		x++;
+	}
+}
+
+/**
+ * @brief Copies a row of pixels (scalar)
+ *
+ * @param dst Destination row
+ * @param src Source row (must not overlap dst)
+ * @param n Number of pixels
+ */
+void	copy_row_scalar(unsigned int *dst, const unsigned int *src, int n)
+{
+	int	x;
+
+	x = 0;
+	while (x < n)
+	{
+		dst[x] = src[x];
+		x++;
+	}
+}
+
+/**
+ * @brief Doubles every pixel of a row (scalar)
+ *
+ * @param dst Destination row, at least 2 * src_w pixels
+ * @param src Source row
+ * @param src_w Number of source pixels
+ */
+void	upscale_row_2x_scalar(unsigned int *dst, const unsigned int *src,
+		int src_w)
+{
+	int	x;
+
+	x = 0;
+	while (x < src_w)
+	{
+		dst[2 * x] = src[x];
+		dst[2 * x + 1] = src[x];
+		x++;
+	}
+}
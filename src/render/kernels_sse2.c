@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernels_sse2.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:40:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:36:10 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+#ifdef __SSE2__
+# include <emmintrin.h>
+
+/**
+ * @brief Fills a row of pixels with one color, 4 pixels per store (SSE2)
+ *
+ * @param dst First pixel of the row
+ * @param color Packed pixel color
+ * @param n Number of pixels
+ */
+void	fill_row_sse2(unsigned int *dst, unsigned int color, int n)
+{
+	__m128i	px;
+	int		x;
+
+	px = _mm_set1_epi32((int)color);
+	x = 0;
+	while (x + 4 <= n)
+	{
+		_mm_storeu_si128((__m128i *)(dst + x), px);
+		x += 4;
+	}
+	fill_row_scalar(dst + x, color, n - x);
+}
+
+/**
+ * @brief Copies a row of pixels, 4 pixels per store (SSE2)
+ *
+ * @param dst Destination row
+ * @param src Source row (must not overlap dst)
+ * @param n Number of pixels
+ */
+void	copy_row_sse2(unsigned int *dst, const unsigned int *src, int n)
+{
+	int	x;
+
+	x = 0;
+	while (x + 4 <= n)
+	{
+		_mm_storeu_si128((__m128i *)(dst + x),
+			_mm_loadu_si128((const __m128i *)(src + x)));
+		x += 4;
+	}
+	copy_row_scalar(dst + x, src + x, n - x);
+}
+
+/**
+ * @brief Doubles every pixel of a row (SSE2)
+ *
+ * Loads 4 pixels at a time and interleaves them with themselves,
+ * producing 8 output pixels per iteration. The tail is done scalar.
+ *
+ * @param dst Destination row, at least 2 * src_w pixels
+ * @param src Source row
+ * @param src_w Number of source pixels
+ */
+void	upscale_row_2x_sse2(unsigned int *dst, const unsigned int *src,
+		int src_w)
+{
+	__m128i	px;
+	int		x;
+
+	x = 0;
+	while (x + 4 <= src_w)
+	{
+		px = _mm_loadu_si128((const __m128i *)(src + x));
+		_mm_storeu_si128((__m128i *)(dst + 2 * x), _mm_unpacklo_epi32(px, px));
+		_mm_storeu_si128((__m128i *)(dst + 2 * x + 4),
+			_mm_unpackhi_epi32(px, px));
+		x += 4;
+	}
+	upscale_row_2x_scalar(dst + 2 * x, src + x, src_w - x);
+}
+
+/**
+ * @brief Fills in the SSE2 kernel table
+ *
+ * SSE2 has no gather, so the nearest sampler stays scalar.
+ *
+ * @param k Table to fill, or NULL to only check that the kernels exist
+ * @return true, the SSE2 kernels are built in
+ */
+bool	sse2_kernels(t_kernels *k)
+{
+	if (k)
+		*k = (t_kernels){ISA_SSE2, fill_row_sse2, copy_row_sse2,
+			upscale_row_2x_sse2, sample_wall_bilinear_sse2,
+			sample_wall_nearest_scalar};
+	return (true);
+}
+
+#else
+
+/**
+ * @brief Reports that the SSE2 kernels are not built in
+ *
+ * @param k Unused
+ * @return false
+ */
+bool	sse2_kernels(t_kernels *k)
+{
+	(void)k;
+	return (false);
+}
+
+#endif
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_scale.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:52:52 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Fills the per-column lookup tables for the current frame size
+ *
+ * camera_x maps every render column to camera space (-1.0 to +1.0) and
+ * x_map maps every window column to the render column it samples from.
+ * Both only depend on the frame and window sizes, so they are computed
+ * once per size change instead of once per column per frame.
+ *
+ * @param game Pointer to game structure (frame size already updated)
+ */
+static void	build_column_tables(t_game *game)
+{
+	int	x;
+
+	x = 0;
+	while (x < game->frame.width)
+	{
+		game->frame.camera_x[x] = 2.0 * x / game->frame.width - 1.0;
+		x++;
+	}
+	x = 0;
+	while (x < game->win_w)
+	{
+		game->scaler.x_map[x] = x * game->frame.width / game->win_w;
+		x++;
+	}
+}
+
+/**
+ * @brief Switches the internal render resolution to a new scale level
+ *
+ * At full level the raycaster draws straight into the window image, so
+ * no upscale pass is needed. Below it, the raycaster draws into the
+ * low resolution buffer that upscale_frame() later stretches.
+ * Resets the controller counters so a new level is always held for a
+ * while before the next change (hysteresis), and rescales the average
+ * frame time by the pixel count ratio of both levels. The average is
+ * first capped at the budget: after a drop, the frames that caused it
+ * can no longer push it over budget and chain more drops.
+ *
+ * @param game Pointer to game structure (image buffer must exist)
+ * @param level Scale level, RENDER_SCALE_MIN to RENDER_SCALE_DEN
+ */
+void	set_render_level(t_game *game, int level)
+{
+	t_scaler	*s;
+
+	s = &game->scaler;
+	if (s->level > 0)
+	{
+		if (s->avg_us > RENDER_BUDGET_US)
+			s->avg_us = RENDER_BUDGET_US;
+		s->avg_us = s->avg_us * level * level / (s->level * s->level);
+	}
+	game->scaler.level = level;
+	game->scaler.over_count = 0;
+	game->scaler.under_count = 0;
+	game->frame.width = game->win_w * level / RENDER_SCALE_DEN;
+	game->frame.height = game->win_h * level / RENDER_SCALE_DEN;
+	game->frame.pixels = game->scaler.buffer;
+	game->frame.stride = game->frame.width;
+	if (level >= RENDER_SCALE_DEN)
+	{
+		game->frame.pixels = (unsigned int *)game->img_addr;
+		game->frame.stride = game->img_line_len / 4;
+	}
+	build_column_tables(game);
+}
+
+/**
+ * @brief Allocates the frame sized buffers and starts at full resolution
+ *
+ * The render buffer, per-column tables and the AA row buffer (one saved
+ * pixel and three channel sums per row) are sized for the window chosen
+ * at startup, so any scale level fits without reallocating during the
+ * game loop.
+ *
+ * @param game Pointer to game structure (image buffer must exist)
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on allocation failure
+ */
+int	init_render_scale(t_game *game)
+{
+	game->scaler.buffer = malloc(sizeof(unsigned int)
+			* game->win_w * game->win_h);
+	game->scaler.x_map = malloc(sizeof(int) * game->win_w);
+	game->frame.camera_x = malloc(sizeof(double) * game->win_w);
+	game->frame.columns = malloc(sizeof(t_draw_info) * game->win_w);
+	game->frame.aa_rows = malloc(sizeof(unsigned int) * 4 * game->win_h);
+	if (!game->scaler.buffer || !game->scaler.x_map || !game->frame.camera_x
+		|| !game->frame.columns || !game->frame.aa_rows)
+	{
+		cleanup_render_scale(game);
+		print_errors(SCALE_INIT, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	game->scaler.avg_us = 0;
+	set_render_level(game, RENDER_SCALE_DEN);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Adjusts the render scale from the measured frame time
+ *
+ * Smooths the frame time with an exponential moving average, then:
+ *   - drops one level after SCALE_DROP_FRAMES frames over budget
+ *   - raises one level after SCALE_RAISE_FRAMES frames under
+ *     SCALE_RAISE_PCT of the budget
+ *
+ * The gap between both thresholds is wider than the cost ratio of two
+ * neighbouring levels, so a raise never lands straight back over budget
+ * and the controller does not oscillate.
+ *
+ * @param game Pointer to game structure
+ * @param frame_us Time spent rendering the last frame, in microseconds
+ */
+void	update_render_scale(t_game *game, long frame_us)
+{
+	t_scaler	*s;
+
+	s = &game->scaler;
+	s->avg_us += (frame_us - s->avg_us) / SCALE_EMA_WEIGHT;
+	if (s->avg_us > RENDER_BUDGET_US)
+		s->over_count++;
+	else
+		s->over_count = 0;
+	if (s->avg_us < RENDER_BUDGET_US * SCALE_RAISE_PCT / 100)
+		s->under_count++;
+	else
+		s->under_count = 0;
+	if (s->over_count >= SCALE_DROP_FRAMES && s->level > RENDER_SCALE_MIN)
+		set_render_level(game, s->level - 1);
+	else if (s->under_count >= SCALE_RAISE_FRAMES
+		&& s->level < RENDER_SCALE_DEN)
+		set_render_level(game, s->level + 1);
+}
+
+/**
+ * @brief Frees the scaled render buffer, per-column tables and AA rows
+ *
+ * Safe to call on a partially initialized scaler.
+ *
+ * @param game Pointer to game structure
+ */
+void	cleanup_render_scale(t_game *game)
+{
+	free(game->scaler.buffer);
+	game->scaler.buffer = NULL;
+	free(game->scaler.x_map);
+	game->scaler.x_map = NULL;
+	free(game->frame.camera_x);
+	game->frame.camera_x = NULL;
+	free(game->frame.columns);
+	game->frame.columns = NULL;
+	free(game->frame.aa_rows);
+	game->frame.aa_rows = NULL;
+}
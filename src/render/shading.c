@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shading.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:19:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:19:13 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Precomputes the channel tables of every fog level
+ *
+ * Level l blends each 8-bit channel l / (SHADE_LEVELS - 1) of the way
+ * towards FOG_COLOR: level 0 is the unchanged color, the last level is
+ * the fog color itself. Shading a pixel at draw time is then three
+ * table lookups, with no per-pixel multiply.
+ *
+ * @param shade Shade state with fog_dist set (> 0)
+ */
+void	build_shade_tables(t_shade *shade)
+{
+	int		level;
+	int		channel;
+	int		v;
+	int		fog;
+
+	shade->level_scale = (SHADE_LEVELS - 1) / shade->fog_dist;
+	level = 0;
+	while (level < SHADE_LEVELS)
+	{
+		channel = 0;
+		while (channel < 3)
+		{
+			fog = (FOG_COLOR >> (16 - 8 * channel)) & 0xFF;
+			v = 0;
+			while (v < 256)
+			{
+				shade->lut[level][channel * 256 + v] = (unsigned char)(v
+						+ (fog - v) * (double)level / (SHADE_LEVELS - 1) + 0.5);
+				v++;
+			}
+			channel++;
+		}
+		level++;
+	}
+}
+
+/**
+ * @brief Returns the fog level of a surface seen at a given distance
+ *
+ * Levels grow linearly with the distance and reach the last one (plain
+ * fog) at fog_dist. Called once per wall column or floor row.
+ *
+ * @param shade Shade state
+ * @param dist Perpendicular distance to the surface
+ * @return Level in [0, SHADE_LEVELS - 1], always 0 when fog is off
+ */
+int	shade_level(const t_shade *shade, double dist)
+{
+	int	level;
+
+	if (shade->fog_dist <= 0)
+		return (0);
+	level = (int)(dist * shade->level_scale);
+	if (level >= SHADE_LEVELS)
+		level = SHADE_LEVELS - 1;
+	if (level < 0)
+		level = 0;
+	return (level);
+}
+
+/**
+ * @brief Returns the channel table to shade a surface with
+ *
+ * @param shade Shade state
+ * @param dist Perpendicular distance to the surface
+ * @return Table of the matching fog level, NULL when no shading is
+ *         needed (fog off or level 0)
+ */
+const unsigned char	*shade_lut(const t_shade *shade, double dist)
+{
+	int	level;
+
+	level = shade_level(shade, dist);
+	if (level == 0)
+		return (NULL);
+	return (shade->lut[level]);
+}
+
+/**
+ * @brief Shades one packed color through a level's channel tables
+ *
+ * @param shade Channel tables of one level (see t_shade.lut)
+ * @param color Packed pixel color
+ * @return Shaded color, the top byte is kept as is
+ */
+unsigned int	shade_pixel(const unsigned char *shade, unsigned int color)
+{
+	return ((color & 0xFF000000)
+		| (unsigned int)shade[(color >> 16) & 0xFF] << 16
+		| (unsigned int)shade[256 + ((color >> 8) & 0xFF)] << 8
+		| (unsigned int)shade[512 + (color & 0xFF)]);
+}
+
+/**
+ * @brief Returns the distance of the floor or ceiling seen on a row
+ *
+ * Every pixel of a screen row sees the floor (below the horizon) or
+ * the ceiling (above it) at the same distance. Rows above the horizon
+ * are mirrored onto the floor row at the same distance.
+ *
+ * @param frame Render target
+ * @param y Screen row
+ * @return Perpendicular distance, in map cells
+ */
+double	row_distance(const t_frame *frame, int y)
+{
+	double	offset;
+
+	if (y < frame->height / 2)
+		y = frame->height - 1 - y;
+	offset = y + 0.5 - 0.5 * frame->height;
+	if (offset < 0.5)
+		offset = 0.5;
+	return (0.5 * frame->height / offset);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   upscale.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:52:52 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 06:55:16 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Stretches one render row across a full window row
+ *
+ * Uses the SIMD pixel doubling kernel when the render width is exactly
+ * half the window width, and the precomputed column table otherwise.
+ *
+ * @param game Pointer to game structure
+ * @param dst First pixel of the destination window row
+ * @param src_y Render row to sample from
+ */
+static void	upscale_row(t_game *game, unsigned int *dst, int src_y)
+{
+	unsigned int	*src;
+	int				x;
+
+	src = game->frame.pixels + src_y * game->frame.stride;
+	if (game->frame.width * 2 == game->win_w)
+	{
+		upscale_row_2x(dst, src, game->frame.width);
+		return ;
+	}
+	x = 0;
+	while (x < game->win_w)
+	{
+		dst[x] = src[game->scaler.x_map[x]];
+		x++;
+	}
+}
+
+/**
+ * @brief Upscales the low resolution render into the window image
+ *
+ * Nearest neighbour upscale. Each render row is expanded once; window
+ * rows that sample the same render row are plain copies of the row
+ * above. Does nothing at full resolution, where the raycaster already
+ * drew into the window image.
+ *
+ * @param game Pointer to game structure
+ */
+void	upscale_frame(t_game *game)
+{
+	unsigned int	*dst;
+	int				stride;
+	int				y;
+	int				src_y;
+	int				last_src_y;
+
+	if (game->scaler.level >= RENDER_SCALE_DEN)
+		return ;
+	dst = (unsigned int *)game->img_addr;
+	stride = game->img_line_len / 4;
+	last_src_y = -1;
+	y = 0;
+	while (y < game->win_h)
+	{
+		src_y = y * game->frame.height / game->win_h;
+		if (src_y == last_src_y)
+			copy_row(dst + y * stride, dst + (y - 1) * stride, game->win_w);
+		else
+			upscale_row(game, dst + y * stride, src_y);
+		last_src_y = src_y;
+		y++;
+	}
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_count.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:29:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:24:57 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Counters of the allocator calls, bumped by src/debug/alloc_hooks.c.
+ *
+ * counts[0] is the number of malloc(), calloc() and realloc() calls,
+ * counts[1] the number of free() calls. Without ALLOC_DEBUG=1 nothing
+ * bumps them and they stay at 0.
+ *
+ * @return The two counters.
+ */
+long	*alloc_counter(void)
+{
+	static long	counts[2];
+
+	return (counts);
+}
+
+/**
+ * @brief Reads the allocator call counters (see alloc_counter()).
+ *
+ * @param counts Filled with the allocations, then the frees, so far.
+ */
+void	alloc_counts(long counts[2])
+{
+	counts[0] = __atomic_load_n(&alloc_counter()[0], __ATOMIC_RELAXED);
+	counts[1] = __atomic_load_n(&alloc_counter()[1], __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Warns when a frame after the first one called the allocator.
+ *
+ * The first frame may still set things up; every later one, and the
+ * input handlers run before it, must work on the buffers allocated
+ * before. Only reports anything in a build made with ALLOC_DEBUG=1.
+ *
+ * @param before Counters read at the end of the previous frame.
+ */
+void	check_frame_allocs(const long before[2])
+{
+	static long	frame;
+	long		after[2];
+
+	alloc_counts(after);
+	if (frame++ > 0 && (after[0] != before[0] || after[1] != before[1]))
+		printf(YEL FRAME_ALLOC_MSG RESET, frame - 1, after[0] - before[0],
+			after[1] - before[1]);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:23:59 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:41:25 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the single block of an arena.
+ *
+ * @param arena Arena to set up.
+ * @param cap Size of the block, in bytes (0 is allowed).
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure.
+ */
+int	arena_init(t_arena *arena, size_t cap)
+{
+	arena->used = 0;
+	arena->cap = cap;
+	arena->base = malloc(cap + (cap == 0));
+	if (!arena->base)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Carves size bytes from the arena, aligned to ARENA_ALIGN.
+ *
+ * The memory is only given back by arena_free(), all at once. Each
+ * call after the first may skip up to ARENA_ALIGN - 1 bytes, which the
+ * arena size must allow for.
+ *
+ * @param arena Arena set up by arena_init().
+ * @param size Number of bytes.
+ * @return Address in the arena block, or NULL if the block is full.
+ */
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	size_t	start;
+
+	start = (arena->used + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+	if (start > arena->cap || size > arena->cap - start)
+		return (NULL);
+	arena->used = start + size;
+	return (arena->base + start);
+}
+
+/**
+ * @brief Copies a string into the arena without the characters of set
+ *        at both ends, like ft_strtrim(): the trimmed part is found in
+ *        place (view_trim()), then copied once.
+ *
+ * @param arena Arena set up by arena_init().
+ * @param s String to copy.
+ * @param set Characters to trim.
+ * @return Trimmed copy, or NULL if the arena is full.
+ */
+char	*arena_strtrim(t_arena *arena, const char *s, const char *set)
+{
+	t_view	view;
+	char	*copy;
+
+	view = view_trim(s, set);
+	copy = arena_alloc(arena, view.len + 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, view.s, view.len);
+	copy[view.len] = '\0';
+	return (copy);
+}
+
+/**
+ * @brief Frees the arena block, and everything carved from it.
+ *
+ * @param arena Arena to free; safe to call on a zeroed or freed arena.
+ */
+void	arena_free(t_arena *arena)
+{
+	free(arena->base);
+	arena->base = NULL;
+	arena->used = 0;
+	arena->cap = 0;
+}
+
+/**
+ * @brief Appends size bytes to the arena, doubling its block when full.
+ *
+ * For an arena filled as one growing buffer (from a zeroed one, or
+ * arena_init()), never mixed with arena_alloc(): the block may move
+ * when it grows, so what it holds is found again by offset, not by
+ * address. Appends are not aligned.
+ *
+ * @param arena Arena to append to.
+ * @param data Bytes to copy.
+ * @param size Number of bytes.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure (arena kept).
+ */
+int	arena_append(t_arena *arena, const void *data, size_t size)
+{
+	char	*grown;
+	size_t	cap;
+
+	if (size > arena->cap - arena->used)
+	{
+		cap = arena->cap * 2 + ARENA_GROW_MIN;
+		while (cap - arena->used < size)
+			cap *= 2;
+		grown = malloc(cap);
+		if (!grown)
+			return (EXIT_FAILURE);
+		ft_memcpy(grown, arena->base, arena->used);
+		free(arena->base);
+		arena->base = grown;
+		arena->cap = cap;
+	}
+	ft_memcpy(arena->base + arena->used, data, size);
+	arena->used += size;
+	return (EXIT_SUCCESS);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 18:13:01 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/12/27 18:13:02 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,7 @@
  *
  * Displays ASCII art logo for "CUB3D" in green color,
  * followed by yellow-colored control instructions for the player.
+ * The whole text is buffered and written at once.
  *
  * Output includes:
  *   - "CUB3D" ASCII art banner
@@ -26,17 +27,40 @@
  */
 void	print_ascii_art_hello(void)
 {
-	printf("Welcome to\n");
-	printf(BR_GRN);
-	printf(" ██████╗██╗   ██╗██████╗ ██████╗ ██████╗\n");
-	printf("██╔════╝██║   ██║██╔══██╗╚════██╗██╔══██╗\n");
-	printf("██║     ██║   ██║██████╔╝ █████╔╝██║  ██║\n");
-	printf("██║     ██║   ██║██╔══██╗ ╚═══██╗██║  ██║\n");
-	printf("╚██████╗╚██████╔╝██████╔╝██████╔╝██████╔╝\n");
-	printf(" ╚═════╝ ╚═════╝ ╚═════╝ ╚═════╝ ╚═════╝\n");
-	printf(RESET);
-	printf(BR_YEL);
-	printf("use WASD to move - left/right arrow (or mouse) to rotate camera\n");
-	printf("press ESC or click the window cross to exit game\n\n");
-	printf(RESET);
+	t_outbuf	out;
+
+	ft_outbuf_init(&out, STDOUT_FILENO);
+	ft_outbuf_putstr(&out, "Welcome to\n" BR_GRN);
+	ft_outbuf_putstr(&out, " ██████╗██╗   ██╗██████╗ ██████╗ ██████╗\n");
+	ft_outbuf_putstr(&out, "██╔════╝██║   ██║██╔══██╗╚════██╗██╔══██╗\n");
+	ft_outbuf_putstr(&out, "██║     ██║   ██║██████╔╝ █████╔╝██║  ██║\n");
+	ft_outbuf_putstr(&out, "██║     ██║   ██║██╔══██╗ ╚═══██╗██║  ██║\n");
+	ft_outbuf_putstr(&out, "╚██████╗╚██████╔╝██████╔╝██████╔╝██████╔╝\n");
+	ft_outbuf_putstr(&out, " ╚═════╝ ╚═════╝ ╚═════╝ ╚═════╝ ╚═════╝\n");
+	ft_outbuf_putstr(&out, RESET BR_YEL);
+	ft_outbuf_putstr(&out,
+		"use WASD to move - left/right arrow (or mouse) to rotate camera\n");
+	ft_outbuf_putstr(&out, "press ESC or click the window cross to exit game\n"
+		"\n" RESET);
+	ft_outbuf_flush(&out);
+}
+
+/**
+ * @brief Prints what the game shows at startup, by verbosity level
+ *
+ *   - VERBOSITY_QUIET (--quiet): nothing
+ *   - VERBOSITY_NORMAL: the banner and the map statistics
+ *   - VERBOSITY_MAP (--verbose): the map grid as well, whose size grows
+ *     with the map area
+ *
+ * @param game Pointer to game structure (map loaded)
+ */
+void	print_startup_info(t_game *game)
+{
+	if (game->verbosity >= VERBOSITY_NORMAL)
+		print_ascii_art_hello();
+	if (game->verbosity >= VERBOSITY_MAP)
+		print_map_grid(&game->map);
+	if (game->verbosity >= VERBOSITY_NORMAL)
+		print_map_stats(&game->map);
 }
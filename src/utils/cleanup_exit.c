@@ -6,16 +6,17 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 18:13:07 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/12/27 20:17:28 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:24:00 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
 /**
-  * @brief Frees all loaded wall textures
+  * @brief Frees all loaded wall, floor and ceiling textures
   *
-  * Destroys MLX image objects for all 4 wall textures.
+  * Destroys MLX image objects still held by wall and surface textures
+  * and frees the texture atlas holding their packed mip chains.
   * Checks for NULL before destroying to handle partial initialization.
   * Safe to call even if textures were never loaded.
   *
@@ -26,19 +27,36 @@ void	cleanup_textures(t_game *game)
 	int	i;
 
 	i = 0;
-	while (i < TEX_SIZE)
+	while (i < HEADER_SIZE)
 	{
 		if (game->textures[i].img)
 			mlx_destroy_image(game->mlx, game->textures[i].img);
+		game->textures[i].img = NULL;
+		game->textures[i].mip_count = 0;
 		i++;
 	}
+	free_texture_atlas(&game->atlas);
+}
+
+/**
+ * @brief Frees the texture atlas
+ *
+ * @param atlas Atlas to free, safe to call if it was never built
+ */
+void	free_texture_atlas(t_atlas *atlas)
+{
+	free(atlas->raw);
+	atlas->raw = NULL;
+	atlas->data = NULL;
+	atlas->size = 0;
 }
 
 /**
  * @brief Frees all dynamic allocations inside a t_map structure.
  *
- * This frees the map grid (via free_map_grid), texture paths, and resets
- * floor and ceiling colors to zero. All pointers are set to NULL.
+ * This frees the map grid (via free_map_grid), the block holding the
+ * texture paths, and resets floor and ceiling colors to zero. All
+ * pointers are set to NULL.
  *
  * @param map Pointer to the t_map structure. Does nothing if NULL.
  *
@@ -52,16 +70,10 @@ void	free_t_map(t_map *map)
 	if (!map)
 		return ;
 	free_map_grid(map);
+	arena_free(&map->strings);
 	i = 0;
-	while (i < TEX_SIZE)
-	{
-		if (map->tex_paths[i])
-		{
-			free(map->tex_paths[i]);
-			map->tex_paths[i] = NULL;
-		}
-		i++;
-	}
+	while (i < HEADER_SIZE)
+		map->tex_paths[i++] = NULL;
 	i = 0;
 	while (i < RGB_SIZE)
 	{
@@ -69,6 +81,8 @@ void	free_t_map(t_map *map)
 		map->ceiling_color[i] = 0;
 		i++;
 	}
+	map->floor_rgb = 0;
+	map->ceiling_rgb = 0;
 }
 
 /**
@@ -89,6 +103,7 @@ void	cleanup_game(t_game *game)
 		cleanup_textures(game);
 	if (game->img)
 		mlx_destroy_image(game->mlx, game->img);
+	cleanup_render_scale(game);
 	if (game->win)
 		mlx_destroy_window(game->mlx, game->win);
 	if (game->mlx)
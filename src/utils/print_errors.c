@@ -6,17 +6,56 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 18:13:12 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/12/27 18:13:13 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:34:18 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
+/**
+ * @brief Returns the error log of the calling thread
+ *
+ * While the log is set, print_errors() appends its messages to it instead
+ * of printing them, so --check workers can report errors per file.
+ *
+ * @return Address of the calling thread's log pointer, NULL by default
+ */
+t_error_log	**error_log(void)
+{
+	static _Thread_local t_error_log	*log;
+
+	return (&log);
+}
+
+/**
+ * @brief Appends a message part to an error log, on a single line
+ *
+ * Whitespace becomes a plain space, and the message is cut when the log
+ * is full.
+ *
+ * @param log Error log to extend
+ * @param part Message part (can be NULL)
+ */
+static void	log_append(t_error_log *log, const char *part)
+{
+	while (part && *part && log->len + 1 < ERROR_LOG_SIZE)
+	{
+		if (ft_isspace(*part))
+			log->msg[log->len++] = ' ';
+		else
+			log->msg[log->len++] = *part;
+		part++;
+	}
+	log->msg[log->len] = '\0';
+}
+
 /**
  * @brief Print an error message with optional parts.
  *
  * This function prints "Error" followed by up to three optional
- * message strings.
+ * message strings, with a single write. When the calling thread has an
+ * error log, the message is appended to it instead, after a "; "
+ * separator.
  *
  * @param p1 First part of the error message (can be NULL).
  * @param p2 Second part of the error message (can be NULL).
@@ -24,12 +63,24 @@
  */
 void	print_errors(char *p1, char *p2, char *p3)
 {
-	write(STDERR_FILENO, "Error\n", 7);
-	if (p1)
-		write(STDERR_FILENO, p1, ft_strlen(p1));
-	if (p2)
-		write(STDERR_FILENO, p2, ft_strlen(p2));
-	if (p3)
-		write(STDERR_FILENO, p3, ft_strlen(p3));
-	write(STDERR_FILENO, "\n", 1);
+	t_error_log	*log;
+	t_outbuf	out;
+
+	log = *error_log();
+	if (log)
+	{
+		if (log->len > 0)
+			log_append(log, "; ");
+		log_append(log, p1);
+		log_append(log, p2);
+		log_append(log, p3);
+		return ;
+	}
+	ft_outbuf_init(&out, STDERR_FILENO);
+	ft_outbuf_putstr(&out, "Error\n");
+	ft_outbuf_putstr(&out, p1);
+	ft_outbuf_putstr(&out, p2);
+	ft_outbuf_putstr(&out, p3);
+	ft_outbuf_putchar(&out, '\n');
+	ft_outbuf_flush(&out);
 }
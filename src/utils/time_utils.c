@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:52:53 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 06:52:53 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Returns the current wall clock time in microseconds
+ *
+ * Used to measure how long a frame takes to render.
+ *
+ * @return Microseconds since the epoch
+ */
+long	get_time_us(void)
+{
+	struct timeval	now;
+
+	gettimeofday(&now, NULL);
+	return (now.tv_sec * US_PER_SECOND + now.tv_usec);
+}
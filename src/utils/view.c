@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   view.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:38:30 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:38:30 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "cub3d.h"
+
+/**
+ * @brief Returns the part of a string left once the characters of set
+ *        are removed at both ends, like ft_strtrim(), without copying.
+ *
+ * @param s String to trim.
+ * @param set Characters to trim.
+ * @return View into s.
+ */
+t_view	view_trim(const char *s, const char *set)
+{
+	t_view	view;
+
+	while (*s && ft_strchr(set, *s))
+		s++;
+	view.s = s;
+	view.len = ft_strlen(s);
+	while (view.len > 0 && ft_strchr(set, s[view.len - 1]))
+		view.len--;
+	return (view);
+}
+
+/**
+ * @brief Finds the next field of a string split on sep, the way
+ *        ft_split() splits it: empty fields are skipped.
+ *
+ * @param cursor Position in the string, moved past the field.
+ * @param sep Field separator.
+ * @param field Set to the field found, in place.
+ * @return true if a field was found, false at the end of the string.
+ */
+bool	view_next_field(const char **cursor, char sep, t_view *field)
+{
+	while (**cursor == sep)
+		(*cursor)++;
+	if (**cursor == '\0')
+		return (false);
+	field->s = *cursor;
+	while (**cursor && **cursor != sep)
+		(*cursor)++;
+	field->len = *cursor - field->s;
+	return (true);
+}
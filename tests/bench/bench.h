@@ -0,0 +1,53 @@
+/**
+ * @file bench.h
+ * @brief Shared helpers of the micro-benchmarks (tests/bench/).
+ *
+ * Each benchmark times a function over a number of rounds after a
+ * calibration run, and prints the mean ns/op, its standard deviation
+ * and the fastest round. Inputs come from fixed seeds, so two runs on
+ * the same tree time the same work.
+ */
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "cub3d.h"
+# include <assert.h>
+# include <stdio.h>
+# include <string.h>
+
+# define BENCH_SEED 42
+# define BENCH_ROUNDS 7
+/* a round lasts at least this long, once calibrated */
+# define BENCH_ROUND_NS 20000000.0
+/* an op slower than this is timed once */
+# define BENCH_SLOW_NS 1000000000.0
+/* a size whose ops are expected to take longer than this is skipped */
+# define BENCH_SKIP_NS 10000000000.0
+# define BENCH_MAX_SIZE 16384
+# define BENCH_SIZE_COUNT 5
+# define BENCH_MAP_FILE "/tmp/cub3d_bench.cub"
+# define BENCH_MAP_LINE 7
+
+/* one timed function: run(ctx, n) performs n ops */
+typedef struct s_bench
+{
+	const char	*name;
+	char		label[32];
+	void		(*run)(void *ctx, long n);
+	void		*ctx;
+	double		mean;
+	double		sd;
+	double		prev;
+}	t_bench;
+
+double		bench_now_ns(void);
+void		bench_run(t_bench *b);
+bool		bench_skip(t_bench *b, const char *label, double last,
+				double next);
+int			bench_sizes(int argc, char **argv, int *sizes);
+unsigned	bench_rand(unsigned *seed);
+
+void		gen_map(t_map *map, int size, unsigned seed);
+int			write_cub(const char *path, const t_map *map);
+
+#endif
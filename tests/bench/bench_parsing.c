@@ -0,0 +1,233 @@
+/**
+ * @file bench_parsing.c
+ * @brief Micro-benchmarks of the .cub parsing and validation functions.
+ *
+ * Times parse_rgb() on seeded color strings, then get_next_line(),
+ * parse_map(), init_player() and check_valid_map() on generated square
+ * maps from 10x10 up to 16384x16384 (see gen_map()). Sizes expected to
+ * take over BENCH_SKIP_NS per op are skipped with their estimate, and
+ * check_valid_map() only runs on maps it accepts (MAX_MAP_W x
+ * MAX_MAP_H). check_map_bands(), the same checks without the size limit,
+ * runs at every size on one band, then on map_band_count() bands (one
+ * thread per CPU). Each size also reports the heap allocations made by
+ * parse_header() (into a string block sized by check_header_count(), as
+ * parse_and_validate_cub() does) and parse_map(), and how many the map
+ * still holds.
+ *
+ * Usage:
+ *   make bench                  (all benchmarks, up to 16384x16384)
+ *   make bench BENCH_MAX=1000   (stop at 1000x1000)
+ */
+#include "bench.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+#define RGB_STRINGS 1024
+#define SIZED_BENCHES 6
+
+typedef struct s_ctx
+{
+	t_game	game;
+	char	rgb[RGB_STRINGS][16];
+	int		fd;
+}	t_ctx;
+
+static void	run_parse_rgb(void *ctx, long n)
+{
+	t_ctx	*c;
+	int		rgb[RGB_SIZE];
+
+	c = ctx;
+	while (n-- > 0)
+		assert(parse_rgb(c->rgb[n % RGB_STRINGS], rgb) == EXIT_SUCCESS);
+}
+
+/**
+ * @brief Reads n map lines, going back to the start of the file at EOF
+ */
+static void	run_get_next_line(void *ctx, long n)
+{
+	t_ctx	*c;
+	char	*line;
+
+	c = ctx;
+	while (n-- > 0)
+	{
+		line = get_next_line(c->fd);
+		if (!line)
+		{
+			gnl_clear_fd(c->fd);
+			lseek(c->fd, 0, SEEK_SET);
+		}
+		free(line);
+	}
+}
+
+static void	run_parse_map(void *ctx, long n)
+{
+	t_map	map;
+
+	(void)ctx;
+	while (n-- > 0)
+	{
+		ft_memset(&map, 0, sizeof(map));
+		map.map_start_line = BENCH_MAP_LINE;
+		assert(parse_map(BENCH_MAP_FILE, &map) == EXIT_SUCCESS);
+		free_t_map(&map);
+	}
+}
+
+static void	run_init_player(void *ctx, long n)
+{
+	t_game	*g;
+
+	g = &((t_ctx *)ctx)->game;
+	while (n-- > 0)
+	{
+		g->map.grid[g->map.height / 2][g->map.width / 2] = 'N';
+		assert(init_player(g) == EXIT_SUCCESS);
+	}
+}
+
+static void	run_check_valid_map(void *ctx, long n)
+{
+	while (n-- > 0)
+		assert(check_valid_map(&((t_ctx *)ctx)->game.map) == EXIT_SUCCESS);
+}
+
+/**
+ * @brief Runs check_map_bands() n times on jobs bands, the player cell
+ *        cleared as init_player() would
+ */
+static void	run_bands(t_map *map, int jobs, long n)
+{
+	map->grid[map->height / 2][map->width / 2] = '0';
+	while (n-- > 0)
+		assert(check_map_bands(map, jobs) == EXIT_SUCCESS);
+}
+
+static void	run_check_map_bands_1(void *ctx, long n)
+{
+	run_bands(&((t_ctx *)ctx)->game.map, 1, n);
+}
+
+static void	run_check_map_bands(void *ctx, long n)
+{
+	t_map	*map;
+
+	map = &((t_ctx *)ctx)->game.map;
+	run_bands(map, map_band_count(map), n);
+}
+
+/**
+ * @brief Prints the allocations made while loading the map file, and the
+ *        blocks the loaded map holds until free_t_map()
+ */
+static void	print_load_allocs(const char *label)
+{
+	t_map	map;
+	size_t	bytes;
+	long	start[2];
+	long	header[2];
+	long	grid[2];
+
+	ft_memset(&map, 0, sizeof(map));
+	assert(check_header_count(BENCH_MAP_FILE, &bytes) == EXIT_SUCCESS);
+	alloc_counts(start);
+	assert(arena_init(&map.strings, bytes) == EXIT_SUCCESS
+		&& parse_header(BENCH_MAP_FILE, &map) == EXIT_SUCCESS);
+	alloc_counts(header);
+	assert(parse_map(BENCH_MAP_FILE, &map) == EXIT_SUCCESS);
+	alloc_counts(grid);
+	printf("%-26s %-13s header %ld (%ld kept), grid %ld (%ld kept)\n",
+		"allocations", label, header[0] - start[0],
+		header[0] - start[0] - header[1] + start[1], grid[0] - header[0],
+		grid[0] - header[0] - grid[1] + header[1]);
+	free_t_map(&map);
+}
+
+/**
+ * @brief Times the sized benchmarks on one size x size map
+ *
+ * init_player() runs before check_valid_map(), which needs the player
+ * cell cleared. A benchmark whose next size is skipped stays skipped.
+ *
+ * @param ratio Side ratio of this size to the previous one, and of the
+ *              next size to this one (0 after the last size)
+ */
+static void	run_size(t_ctx *c, t_bench *b, int size, double ratio[2])
+{
+	char	next[32];
+	int		k;
+
+	gen_map(&c->game.map, size, BENCH_SEED);
+	if (b[0].run || b[1].run)
+	{
+		write_cub(BENCH_MAP_FILE, &c->game.map);
+		snprintf(next, sizeof(next), "%dx%d", size, size);
+		print_load_allocs(next);
+	}
+	c->fd = open(BENCH_MAP_FILE, O_RDONLY);
+	snprintf(next, sizeof(next), "%.0fx%.0f", size * ratio[1],
+		size * ratio[1]);
+	k = -1;
+	while (++k < SIZED_BENCHES)
+	{
+		snprintf(b[k].label, sizeof(b[k].label), "%dx%d", size, size);
+		if (!b[k].run)
+			continue ;
+		if (b[k].run == run_check_valid_map
+			&& (size > MAX_MAP_W || size > MAX_MAP_H))
+		{
+			printf("%-26s %-13s skipped, over MAX_MAP_W x MAX_MAP_H\n",
+				b[k].name, b[k].label);
+			continue ;
+		}
+		bench_run(&b[k]);
+		if (ratio[1] > 0 && bench_skip(&b[k], next, ratio[0], ratio[1]))
+			b[k].run = NULL;
+	}
+	gnl_clear_fd(c->fd);
+	close(c->fd);
+	free_t_map(&c->game.map);
+}
+
+int	main(int argc, char **argv)
+{
+	static t_ctx	c;
+	t_bench			b[SIZED_BENCHES + 1];
+	int				sizes[BENCH_SIZE_COUNT + 1];
+	double			ratio[2];
+	int				i;
+
+	assert(chdir("..") == 0);
+	i = -1;
+	while (++i < RGB_STRINGS)
+		snprintf(c.rgb[i], sizeof(c.rgb[i]), "%d,%d,%d", i * 97 % 256,
+			i % 256, i * 7 % 256);
+	b[SIZED_BENCHES] = (t_bench){.name = "parse_rgb", .label = "1024 colors",
+		.run = run_parse_rgb, .ctx = &c};
+	bench_run(&b[SIZED_BENCHES]);
+	b[0] = (t_bench){.name = "get_next_line (per line)",
+		.run = run_get_next_line, .ctx = &c};
+	b[1] = (t_bench){.name = "parse_map", .run = run_parse_map, .ctx = &c};
+	b[2] = (t_bench){.name = "init_player", .run = run_init_player, .ctx = &c};
+	b[3] = (t_bench){.name = "check_valid_map", .run = run_check_valid_map,
+		.ctx = &c};
+	b[4] = (t_bench){.name = "check_map_bands (1 band)",
+		.run = run_check_map_bands_1, .ctx = &c};
+	b[5] = (t_bench){.name = "check_map_bands (per CPU)",
+		.run = run_check_map_bands, .ctx = &c};
+	sizes[0] = bench_sizes(argc, argv, sizes + 1);
+	i = 0;
+	while (++i <= sizes[0])
+	{
+		ratio[0] = sizes[i] / (double)sizes[i - (i > 1)];
+		ratio[1] = 0;
+		if (i < sizes[0])
+			ratio[1] = sizes[i + 1] / (double)sizes[i];
+		run_size(&c, b, sizes[i], ratio);
+	}
+	unlink(BENCH_MAP_FILE);
+	return (0);
+}
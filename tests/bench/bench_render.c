@@ -0,0 +1,314 @@
+/**
+ * @file bench_render.c
+ * @brief Micro-benchmarks of the ray casting and drawing functions.
+ *
+ * Times cast_ray() from the middle of generated square maps from 10x10
+ * up to 16384x16384 (see gen_map()), over 1024 seeded ray directions,
+ * then draw_textured_wall_slice() for short, screen high and magnified
+ * slices of a random 64x64 texture, and draw_pixel_in_buffer() over a
+ * full HD frame. Drawing does not depend on the map, so it runs once.
+ *
+ * Last, at the default window size (WINDOWS_X x WINDOWS_Y), it times the
+ * parts of the renderer that used to take that size as a compile-time
+ * constant, both ways: the rays of a full resolution frame (camera_x
+ * looked up in frame.camera_x, as cast_column_ray() does, against
+ * 2.0 * x / WINDOWS_X - 1.0) and upscale_frame() at two render levels
+ * (against a copy of it sized by the constants). "runtime" and "const"
+ * should match within the noise: the --res path needs no specialised
+ * instances.
+ *
+ * Usage:
+ *   make bench                  (all benchmarks, up to 16384x16384)
+ *   make bench BENCH_MAX=1000   (stop at 1000x1000)
+ */
+#include "bench.h"
+
+#define RAYS 1024
+#define TEX_DIM 64
+#define FRAME_W 1920
+#define FRAME_H 1080
+#define WINDOW_MAP 64
+
+typedef struct s_ctx
+{
+	t_game			game;
+	double			dir[RAYS][2];
+	int				line_height;
+	long			checksum;
+	unsigned int	texels[TEX_DIM * TEX_DIM];
+}	t_ctx;
+
+static void	run_cast_ray(void *ctx, long n)
+{
+	t_ctx			*c;
+	t_ray_result	r;
+
+	c = ctx;
+	while (n-- > 0)
+	{
+		r = cast_ray(&c->game, c->dir[n % RAYS][0], c->dir[n % RAYS][1]);
+		c->checksum += r.steps;
+	}
+}
+
+static void	run_draw_slice(void *ctx, long n)
+{
+	t_ctx		*c;
+	t_draw_info	info;
+
+	c = ctx;
+	info = (t_draw_info){.line_height = c->line_height, .wall_dir = ID_NO};
+	info.draw_start = fmax(0, (FRAME_H - c->line_height) / 2);
+	info.draw_end = fmin(FRAME_H - 1, info.draw_start + c->line_height - 1);
+	while (n-- > 0)
+	{
+		info.x = n % FRAME_W;
+		info.wall_x = (n % 997) / 997.0;
+		draw_textured_wall_slice(&c->game, info);
+	}
+}
+
+static void	run_draw_pixel(void *ctx, long n)
+{
+	t_game	*g;
+
+	g = &((t_ctx *)ctx)->game;
+	while (n-- > 0)
+		draw_pixel_in_buffer(g, n % FRAME_W, n / FRAME_W % FRAME_H, n);
+}
+
+/**
+ * @brief The rays of one full resolution frame, camera_x looked up in
+ *        the per-size table as cast_column_ray() does
+ */
+static void	run_frame_rays(void *ctx, long n)
+{
+	t_ctx	*c;
+	t_game	*g;
+	double	cam;
+	int		x;
+
+	c = ctx;
+	g = &c->game;
+	while (n-- > 0)
+	{
+		x = -1;
+		while (++x < g->frame.width)
+		{
+			cam = g->frame.camera_x[x];
+			c->checksum += cast_ray(g, g->player.dir_x + g->player.plane_x
+					* cam, g->player.dir_y + g->player.plane_y * cam).steps;
+		}
+	}
+}
+
+/**
+ * @brief The same rays with the width a compile-time constant, as
+ *        before --res
+ */
+static void	run_frame_rays_const(void *ctx, long n)
+{
+	t_ctx	*c;
+	t_game	*g;
+	double	cam;
+	int		x;
+
+	c = ctx;
+	g = &c->game;
+	while (n-- > 0)
+	{
+		x = -1;
+		while (++x < WINDOWS_X)
+		{
+			cam = 2.0 * x / WINDOWS_X - 1.0;
+			c->checksum += cast_ray(g, g->player.dir_x + g->player.plane_x
+					* cam, g->player.dir_y + g->player.plane_y * cam).steps;
+		}
+	}
+}
+
+static void	run_upscale(void *ctx, long n)
+{
+	t_ctx	*c;
+
+	c = ctx;
+	while (n-- > 0)
+		upscale_frame(&c->game);
+	c->checksum += *(unsigned int *)c->game.img_addr;
+}
+
+/**
+ * @brief upscale_row() as it was with the window width a compile-time
+ *        constant
+ */
+static void	upscale_row_const(t_game *g, unsigned int *dst, int src_y)
+{
+	unsigned int	*src;
+	int				x;
+
+	src = g->frame.pixels + src_y * g->frame.stride;
+	if (g->frame.width * 2 == WINDOWS_X)
+	{
+		upscale_row_2x(dst, src, g->frame.width);
+		return ;
+	}
+	x = 0;
+	while (x < WINDOWS_X)
+	{
+		dst[x] = src[g->scaler.x_map[x]];
+		x++;
+	}
+}
+
+/**
+ * @brief upscale_frame() as it was with the window size a compile-time
+ *        constant, for the image of a WINDOWS_X x WINDOWS_Y window
+ */
+static void	run_upscale_const(void *ctx, long n)
+{
+	t_game			*g;
+	unsigned int	*dst;
+	int				src_y;
+	int				last_src_y;
+	int				y;
+
+	g = &((t_ctx *)ctx)->game;
+	dst = (unsigned int *)g->img_addr;
+	while (n-- > 0)
+	{
+		last_src_y = -1;
+		y = -1;
+		while (++y < WINDOWS_Y)
+		{
+			src_y = y * g->frame.height / WINDOWS_Y;
+			if (src_y == last_src_y)
+				copy_row(dst + y * WINDOWS_X, dst + (y - 1) * WINDOWS_X,
+					WINDOWS_X);
+			else
+				upscale_row_const(g, dst + y * WINDOWS_X, src_y);
+			last_src_y = src_y;
+		}
+	}
+	((t_ctx *)ctx)->checksum += *dst;
+}
+
+/**
+ * @brief Times the runtime-sized renderer loops against the constant
+ *        sized ones, at the default window size
+ */
+static void	bench_window(t_ctx *c)
+{
+	static const int	levels[] = {RENDER_SCALE_DEN / 2, 6, 0};
+	t_bench				b[2];
+	int					i;
+
+	gen_map(&c->game.map, WINDOW_MAP, BENCH_SEED);
+	assert(init_player(&c->game) == EXIT_SUCCESS);
+	c->game.win_w = WINDOWS_X;
+	c->game.win_h = WINDOWS_Y;
+	c->game.img_line_len = WINDOWS_X * 4;
+	c->game.img_addr = calloc(WINDOWS_X * WINDOWS_Y, sizeof(unsigned int));
+	assert(c->game.img_addr && init_render_scale(&c->game) == EXIT_SUCCESS);
+	b[0] = (t_bench){.name = "frame rays", .label = "runtime",
+		.run = run_frame_rays, .ctx = c};
+	b[1] = (t_bench){.name = "frame rays", .label = "const",
+		.run = run_frame_rays_const, .ctx = c};
+	bench_run(&b[0]);
+	bench_run(&b[1]);
+	i = -1;
+	while (levels[++i])
+	{
+		set_render_level(&c->game, levels[i]);
+		b[0] = (t_bench){.name = "upscale_frame", .run = run_upscale, .ctx = c};
+		b[1] = (t_bench){.name = "upscale_frame", .run = run_upscale_const,
+			.ctx = c};
+		snprintf(b[0].label, sizeof(b[0].label), "runtime L=%d", levels[i]);
+		snprintf(b[1].label, sizeof(b[1].label), "const L=%d", levels[i]);
+		bench_run(&b[0]);
+		bench_run(&b[1]);
+	}
+	cleanup_render_scale(&c->game);
+	free(c->game.img_addr);
+	free_t_map(&c->game.map);
+}
+
+/**
+ * @brief Times cast_ray() on every map size
+ */
+static void	bench_cast_ray(t_ctx *c, int argc, char **argv)
+{
+	t_bench		b;
+	int			sizes[BENCH_SIZE_COUNT];
+	int			count;
+	int			i;
+
+	b = (t_bench){.name = "cast_ray", .run = run_cast_ray, .ctx = c};
+	count = bench_sizes(argc, argv, sizes);
+	i = -1;
+	while (++i < count)
+	{
+		gen_map(&c->game.map, sizes[i], BENCH_SEED);
+		assert(init_player(&c->game) == EXIT_SUCCESS);
+		snprintf(b.label, sizeof(b.label), "%dx%d", sizes[i], sizes[i]);
+		bench_run(&b);
+		free_t_map(&c->game.map);
+	}
+}
+
+/**
+ * @brief Sets up a 64x64 random wall texture and a full HD frame
+ */
+static void	setup_drawing(t_ctx *c, unsigned int *frame)
+{
+	unsigned int	seed;
+	int				i;
+
+	seed = BENCH_SEED;
+	i = -1;
+	while (++i < TEX_DIM * TEX_DIM)
+		c->texels[i] = bench_rand(&seed);
+	c->game.textures[ID_NO] = (t_texture){.addr = (char *)c->texels,
+		.width = TEX_DIM, .height = TEX_DIM, .bpp = 32,
+		.line_len = TEX_DIM * 4};
+	assert(build_texture_atlas(&c->game.atlas, c->game.textures, 1, NULL)
+		== EXIT_SUCCESS);
+	c->game.frame = (t_frame){.pixels = frame, .width = FRAME_W,
+		.height = FRAME_H, .stride = FRAME_W};
+}
+
+int	main(int argc, char **argv)
+{
+	static t_ctx	c;
+	static int		heights[] = {FRAME_H / 4, FRAME_H, FRAME_H * 4, 0};
+	t_bench			b;
+	unsigned int	seed;
+	int				i;
+
+	seed = BENCH_SEED;
+	i = -1;
+	while (++i < RAYS)
+	{
+		c.dir[i][0] = cos(bench_rand(&seed) % 6283 / 1000.0);
+		c.dir[i][1] = sin(bench_rand(&seed) % 6283 / 1000.0);
+	}
+	init_t_game(&c.game);
+	bench_cast_ray(&c, argc, argv);
+	setup_drawing(&c, malloc(sizeof(unsigned int) * FRAME_W * FRAME_H));
+	assert(c.game.frame.pixels);
+	b = (t_bench){.name = "draw_textured_wall_slice",
+		.run = run_draw_slice, .ctx = &c};
+	i = -1;
+	while (heights[++i])
+	{
+		c.line_height = heights[i];
+		snprintf(b.label, sizeof(b.label), "h=%d", heights[i]);
+		bench_run(&b);
+	}
+	b = (t_bench){.name = "draw_pixel_in_buffer", .label = "1920x1080",
+		.run = run_draw_pixel, .ctx = &c};
+	bench_run(&b);
+	free(c.game.frame.pixels);
+	free_texture_atlas(&c.game.atlas);
+	bench_window(&c);
+	return (c.checksum == 0);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file bench_utils.c
+ * @brief Timing, statistics and map generation for the benchmarks.
+ */
+#include "bench.h"
+#include <time.h>
+
+double	bench_now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static double	time_ops(t_bench *b, long n)
+{
+	double	start;
+
+	start = bench_now_ns();
+	b->run(b->ctx, n);
+	return (bench_now_ns() - start);
+}
+
+/**
+ * @brief Mean and standard deviation of the ns/op of each round
+ *
+ * @return Fastest round, in ns/op
+ */
+static double	round_stats(t_bench *b, const double *ns, int rounds, long n)
+{
+	double	min;
+	int		r;
+
+	b->mean = 0;
+	min = ns[0] / n;
+	r = -1;
+	while (++r < rounds)
+	{
+		b->mean += ns[r] / n / rounds;
+		min = fmin(min, ns[r] / n);
+	}
+	b->sd = 0;
+	r = -1;
+	while (++r < rounds)
+		b->sd += (ns[r] / n - b->mean) * (ns[r] / n - b->mean) / rounds;
+	b->sd = sqrt(b->sd);
+	return (min);
+}
+
+/**
+ * @brief Times b and prints one result line
+ *
+ * The op count per round is doubled until a round lasts BENCH_ROUND_NS,
+ * then BENCH_ROUNDS rounds are timed. An op slower than BENCH_SLOW_NS is
+ * only timed once, and reported without a deviation.
+ */
+void	bench_run(t_bench *b)
+{
+	double	ns[BENCH_ROUNDS];
+	double	min;
+	long	n;
+	int		rounds;
+	int		r;
+
+	b->prev = b->mean;
+	n = 1;
+	ns[0] = time_ops(b, n);
+	while (ns[0] < BENCH_ROUND_NS && ns[0] / n < BENCH_SLOW_NS)
+		ns[0] = time_ops(b, n *= 2);
+	rounds = 1;
+	if (ns[0] / n < BENCH_SLOW_NS)
+		rounds = BENCH_ROUNDS;
+	r = 0;
+	while (++r < rounds)
+		ns[r] = time_ops(b, n);
+	min = round_stats(b, ns, rounds, n);
+	printf("%-26s %-13s %14.1f ns/op +- %5.1f%%  min %14.1f  (%d x %ld)\n",
+		b->name, b->label, b->mean, 100 * b->sd / b->mean, min, rounds, n);
+}
+
+/**
+ * @brief Tells whether the next size is too slow to time
+ *
+ * The cost is extrapolated with the growth seen between the last two
+ * sizes, and at least quadratic in the map side.
+ *
+ * @param b Result at the current size (b->prev: at the previous one)
+ * @param label Label of the next size
+ * @param last Side ratio of the current size to the previous one
+ * @param next Side ratio of the next size to the current one
+ * @return true (and prints the estimate) if the next size is skipped
+ */
+bool	bench_skip(t_bench *b, const char *label, double last, double next)
+{
+	double	exponent;
+	double	estimate;
+
+	exponent = 2;
+	if (b->prev > 0 && last > 1)
+		exponent = fmax(2, log(b->mean / b->prev) / log(last));
+	estimate = b->mean * pow(next, exponent);
+	if (estimate < BENCH_SKIP_NS)
+		return (false);
+	printf("%-26s %-13s skipped, about %.0f s/op\n", b->name, label,
+		estimate / 1e9);
+	return (true);
+}
+
+/**
+ * @brief Map sizes to run: 10, 100, 1000, 4096 and 16384, up to the
+ *        size given as first argument
+ */
+int	bench_sizes(int argc, char **argv, int *sizes)
+{
+	const int	all[BENCH_SIZE_COUNT] = {10, 100, 1000, 4096, BENCH_MAX_SIZE};
+	int			max;
+	int			count;
+
+	max = BENCH_MAX_SIZE;
+	if (argc > 1)
+		max = atoi(argv[1]);
+	count = 0;
+	while (count < BENCH_SIZE_COUNT && all[count] <= max)
+	{
+		sizes[count] = all[count];
+		count++;
+	}
+	return (count);
+}
+
+/**
+ * @brief xorshift32: no short cycles in the low bits, unlike an LCG,
+ *        so pillar layouts do not repeat along the rows of large maps
+ */
+unsigned	bench_rand(unsigned *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (*seed);
+}
+
+/**
+ * @brief Generates a closed size x size arena with scattered pillars
+ *
+ * About one cell in sixteen is a pillar. The player stands in the
+ * middle, facing north, with the cells around it kept open. The grid is
+ * one block, laid out as load_map_grid() does.
+ */
+void	gen_map(t_map *map, int size, unsigned seed)
+{
+	t_arena	arena;
+	int		x;
+	int		y;
+
+	ft_memset(map, 0, sizeof(*map));
+	map->width = size;
+	map->height = size;
+	assert(arena_init(&arena, size * (sizeof(char *) + size + 1)
+			+ ARENA_ALIGN) == 0);
+	map->grid = arena_alloc(&arena, sizeof(char *) * size);
+	map->grid[0] = arena_alloc(&arena, (size_t)size * (size + 1));
+	y = -1;
+	while (++y < size)
+	{
+		map->grid[y] = map->grid[0] + (size_t)y * (size + 1);
+		x = -1;
+		while (++x < size)
+		{
+			map->grid[y][x] = '0';
+			if (y == 0 || x == 0 || y == size - 1 || x == size - 1
+				|| bench_rand(&seed) % 16 == 0)
+				map->grid[y][x] = '1';
+		}
+		map->grid[y][size] = '\0';
+	}
+	y = size / 2 - 1;
+	while (++y < size / 2 + 2 && size > 3)
+		ft_memcpy(map->grid[y] + size / 2 - 1, "000", 3);
+	map->grid[size / 2][size / 2] = 'N';
+}
+
+/**
+ * @brief Writes map as a .cub file, after a six line header whose
+ *        texture paths are relative to the repository root
+ *
+ * @return Index of the first map line, BENCH_MAP_LINE
+ */
+int	write_cub(const char *path, const t_map *map)
+{
+	FILE	*f;
+	int		y;
+
+	f = fopen(path, "w");
+	assert(f);
+	fprintf(f, "NO assets/textures/bricks/NO.xpm\n"
+		"SO assets/textures/bricks/SO.xpm\n"
+		"WE assets/textures/bricks/WE.xpm\n"
+		"EA assets/textures/bricks/EA.xpm\n"
+		"F 220,100,0\nC 225,30,0\n\n");
+	y = -1;
+	while (++y < map->height)
+		fprintf(f, "%s\n", map->grid[y]);
+	fclose(f);
+	return (BENCH_MAP_LINE);
+}
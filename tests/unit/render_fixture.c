@@ -0,0 +1,64 @@
+/**
+ * @file render_fixture.c
+ * @brief Headless render fixture shared by the frame tests (see
+ *        render_fixture.h).
+ */
+#include "render_fixture.h"
+#include <assert.h>
+
+static unsigned int	g_texels[HEADER_SIZE][64 * 64];
+
+/**
+ * @brief Loads a map in one render mode, with synthetic textures
+ *
+ * Every texture has 128 colors, so --palette stores the walls as
+ * indices. Floor and ceiling are only textured when the map says so.
+ */
+void	setup_render_fixture(t_game *g, const char *path,
+		const t_render_mode *mode)
+{
+	int	i;
+	int	k;
+
+	init_t_game(g);
+	assert(parse_and_validate_cub((char *)path, g) == EXIT_SUCCESS);
+	g->span_mode = mode->spans;
+	g->aa_samples = mode->aa;
+	g->bilinear = mode->bilinear;
+	g->palette_mode = mode->palette;
+	g->shade.fog_dist = mode->fog;
+	g->max_ray_dist = mode->max_dist;
+	i = -1;
+	while (++i < HEADER_SIZE)
+	{
+		k = -1;
+		while (++k < 64 * 64)
+			g_texels[i][k] = ((k * 2654435761u) >> 25) * 0x020301 + i * 0x40;
+		if (g->map.tex_paths[i])
+			g->textures[i] = (t_texture){.addr = (char *)g_texels[i],
+				.width = 64, .height = 64, .bpp = 32, .line_len = 64 * 4,
+				.palettise = mode->palette && i < ID_FLOOR};
+	}
+	if (g->shade.fog_dist > 0)
+		build_shade_tables(&g->shade);
+	assert(build_texture_atlas(&g->atlas, g->textures, HEADER_SIZE,
+			&g->shade) == EXIT_SUCCESS);
+	g->win_w = FIXTURE_W;
+	g->win_h = FIXTURE_H;
+	g->img_addr = malloc(sizeof(unsigned int) * FIXTURE_W * FIXTURE_H);
+	g->img_line_len = FIXTURE_W * 4;
+	assert(g->img_addr && init_render_scale(g) == EXIT_SUCCESS);
+	if (mode->level)
+		set_render_level(g, mode->level);
+}
+
+/**
+ * @brief Frees what setup_render_fixture() allocated
+ */
+void	teardown_render_fixture(t_game *g)
+{
+	cleanup_render_scale(g);
+	free_texture_atlas(&g->atlas);
+	free(g->img_addr);
+	free_t_map(&g->map);
+}
@@ -0,0 +1,35 @@
+/**
+ * @file render_fixture.h
+ * @brief Headless render fixture shared by the frame tests
+ *        (test_golden.c, test_frame_allocs.c).
+ *
+ * Loads a map in one render mode into a FIXTURE_W x FIXTURE_H image,
+ * with synthetic 64x64 textures instead of the .xpm files, so frames
+ * need no MLX connection and do not depend on the texture files.
+ */
+#ifndef RENDER_FIXTURE_H
+# define RENDER_FIXTURE_H
+
+# include "cub3d.h"
+
+# define FIXTURE_W 320
+# define FIXTURE_H 180
+
+/* render options of one mode; zeroed fields keep the defaults */
+typedef struct s_render_mode
+{
+	const char	*name;
+	bool		spans;
+	int			aa;
+	bool		bilinear;
+	bool		palette;
+	double		fog;
+	double		max_dist;
+	int			level;
+}	t_render_mode;
+
+void	setup_render_fixture(t_game *g, const char *path,
+			const t_render_mode *mode);
+void	teardown_render_fixture(t_game *g);
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file test_antialias.c
+ * @brief Checks the adaptive edge anti-aliasing (--aa).
+ *
+ * Renders maps of maps/valid from many poses without AA and with 2 to 4
+ * sub-column rays, and requires that:
+ *   - the recorded columns do not change
+ *   - only columns on a geometry edge are redrawn, and all of them are
+ *     counted in frame.aa_columns
+ *   - with one solid color per wall side, every supersampled wall pixel
+ *     is a rounded average of N wall colors, and some of them are blends
+ * Prints the supersampled columns and blended pixels per map.
+ *
+ * Runs headless: wall textures are plain pixel buffers, floor and
+ * ceiling use their flat colors.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_antialias.c
+ *   Run:   ./bin/test_antialias
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEST_W 320
+#define TEST_H 180
+#define POSE_STRIDE 5
+#define POSE_ANGLE 2.39996
+
+static unsigned int	g_texels[ID_FLOOR][16 * 16];
+
+/**
+ * @brief Loads a map with one solid 16x16 texture per wall side
+ *
+ * Channels are only 0x00 or 0xFF, so blends are easy to recognise.
+ */
+static void	setup_map(t_game *g, const char *path)
+{
+	const unsigned int	colors[ID_FLOOR] = {0xFF0000, 0x00FF00, 0x0000FF,
+		0xFFFFFF};
+	int					i;
+	int					k;
+
+	init_t_game(g);
+	assert(parse_and_validate_cub((char *)path, g) == EXIT_SUCCESS);
+	i = 0;
+	while (i < ID_FLOOR)
+	{
+		k = 0;
+		while (k < 16 * 16)
+			g_texels[i][k++] = colors[i];
+		g->textures[i] = (t_texture){.addr = (char *)g_texels[i],
+			.width = 16, .height = 16, .bpp = 32, .line_len = 16 * 4};
+		i++;
+	}
+	assert(build_texture_atlas(&g->atlas, g->textures, ID_FLOOR, NULL)
+		== EXIT_SUCCESS);
+	g->win_w = TEST_W;
+	g->win_h = TEST_H;
+	g->img_addr = malloc(sizeof(unsigned int) * TEST_W * TEST_H);
+	g->img_line_len = TEST_W * 4;
+	assert(g->img_addr && init_render_scale(g) == EXIT_SUCCESS);
+}
+
+static bool	same_column(const t_draw_info *a, const t_draw_info *b)
+{
+	return (a->x == b->x && a->draw_start == b->draw_start
+		&& a->draw_end == b->draw_end && a->wall_dir == b->wall_dir
+		&& a->wall_x == b->wall_x && a->wall_dist == b->wall_dist
+		&& a->far == b->far);
+}
+
+static bool	same_pixels(const unsigned int *a, const unsigned int *b, int x)
+{
+	int	y;
+
+	y = 0;
+	while (y < TEST_H && a[y * TEST_W + x] == b[y * TEST_W + x])
+		y++;
+	return (y == TEST_H);
+}
+
+/**
+ * @brief Same edge rule as the renderer, written independently
+ */
+static bool	is_edge(const t_draw_info *c, int x)
+{
+	const t_draw_info	*n[2];
+	int					i;
+
+	n[0] = NULL;
+	n[1] = NULL;
+	if (x > 0)
+		n[0] = &c[x - 1];
+	if (x + 1 < TEST_W)
+		n[1] = &c[x + 1];
+	i = -1;
+	while (++i < 2)
+	{
+		if (!n[i])
+			continue ;
+		if (n[i]->far != c[x].far || n[i]->map_x != c[x].map_x
+			|| n[i]->map_y != c[x].map_y || n[i]->wall_dir != c[x].wall_dir
+			|| fabs(n[i]->wall_dist - c[x].wall_dist) > AA_DEPTH_RATIO
+			* fmin(n[i]->wall_dist, c[x].wall_dist))
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Checks that every channel of a pixel is an average of N channels
+ *        that are each 0x00 or 0xFF, and tells if the pixel is a blend
+ */
+static bool	check_blend(unsigned int px, int n)
+{
+	bool	blend;
+	int		c;
+	int		k;
+	int		v;
+
+	blend = false;
+	c = 0;
+	while (c < 3)
+	{
+		v = (px >> (8 * c)) & 0xFF;
+		k = 0;
+		while (k <= n && (k * 0xFF + n / 2) / n != v)
+			k++;
+		assert(k <= n);
+		blend |= (k != 0 && k != n);
+		c++;
+	}
+	return (blend);
+}
+
+/**
+ * @brief Renders the current pose without and with AA and compares
+ *
+ * @return Number of blended pixels in the supersampled columns
+ */
+static int	compare_pose(t_game *g, unsigned int *ref, t_draw_info *cols,
+		int n)
+{
+	int	blends;
+	int	edges;
+	int	x;
+
+	g->aa_samples = 0;
+	render_frame(g);
+	assert(g->frame.aa_columns == 0);
+	memcpy(ref, g->frame.pixels, sizeof(unsigned int) * TEST_W * TEST_H);
+	memcpy(cols, g->frame.columns, sizeof(t_draw_info) * TEST_W);
+	g->aa_samples = n;
+	render_frame(g);
+	blends = 0;
+	edges = 0;
+	x = -1;
+	while (++x < TEST_W)
+	{
+		assert(same_column(&cols[x], &g->frame.columns[x]));
+		if (!is_edge(cols, x))
+			assert(same_pixels(ref, g->frame.pixels, x));
+		else
+			blends += check_blend(g->frame.pixels[TEST_H / 2 * TEST_W + x], n);
+		edges += is_edge(cols, x);
+	}
+	assert(edges == g->frame.aa_columns);
+	return (blends);
+}
+
+static void	test_map(const char *path, unsigned int *ref, t_draw_info *cols)
+{
+	t_game	g;
+	int		stats[3];
+	int		x;
+	int		y;
+
+	setup_map(&g, path);
+	memset(stats, 0, sizeof(stats));
+	y = 0;
+	while (++y < g.map.height - 1)
+	{
+		x = 0;
+		while (++x < g.map.width - 1)
+		{
+			if ((x + y) % POSE_STRIDE || !ft_strchr("0NSEW", g.map.grid[y][x]))
+				continue ;
+			g.player.pos_x = x + 0.5;
+			g.player.pos_y = y + 0.25;
+			apply_camera_rotation(&g, POSE_ANGLE);
+			stats[1] += compare_pose(&g, ref, cols, 2 + stats[0]++ % 3);
+			stats[2] += g.frame.aa_columns;
+		}
+	}
+	assert(stats[0] == 0 || stats[1] > 0);
+	printf("%-40s %4d poses, %6d aa columns, %6d blends OK\n", path,
+		stats[0], stats[2], stats[1]);
+	cleanup_render_scale(&g);
+	free_texture_atlas(&g.atlas);
+	free(g.img_addr);
+	free_t_map(&g.map);
+}
+
+int	main(void)
+{
+	static unsigned int	ref[TEST_W * TEST_H];
+	static t_draw_info	cols[TEST_W];
+	const char			*maps[] = {
+		"maps/valid/bricks_arena.cub", "maps/valid/bricks_pdf_map.cub",
+		"maps/valid/clouds_rooms.cub", "maps/valid/dino_weird_map.cub",
+		"maps/valid/twin_peaks_spaceship_map.cub", NULL};
+	int					i;
+
+	assert(chdir("..") == 0);
+	i = 0;
+	while (maps[i])
+		test_map(maps[i++], ref, cols);
+	printf("All anti-aliasing tests passed!\n");
+	return (0);
+}
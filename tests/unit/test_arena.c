@@ -0,0 +1,187 @@
+/**
+ * @file test_arena.c
+ * @brief Tests the arena allocator and the map blocks built with it.
+ *
+ * It checks:
+ *   - arena_alloc() aligns each allocation and refuses to overflow
+ *   - arena_strtrim() trims like ft_strtrim()
+ *   - a loaded grid is one block: row pointers, then adjacent rows
+ *   - texture paths live in the map's string block, sized from the
+ *     header lines by check_header_count(); a block that is missing or
+ *     full grows, keeping the paths already stored, whatever their order
+ *   - loading a grid reads the file once into arenas that double as they
+ *     fill: 10000 times the rows only take a few more allocations
+ *
+ * Linked with the counting allocator hooks (src/debug/alloc_hooks.c).
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_arena.c
+ *   Run:   ./bin/test_arena
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+static void	test_alloc(void)
+{
+	t_arena	a;
+	char	*p;
+	char	*q;
+
+	assert(arena_init(&a, 64) == EXIT_SUCCESS);
+	p = arena_alloc(&a, 3);
+	q = arena_alloc(&a, 5);
+	assert(p == a.base && q == a.base + ARENA_ALIGN);
+	assert((uintptr_t)q % ARENA_ALIGN == 0);
+	assert(arena_alloc(&a, 64 - ARENA_ALIGN * 2 + 1) == NULL);
+	assert(arena_alloc(&a, 64 - ARENA_ALIGN * 2) != NULL);
+	assert(arena_alloc(&a, 1) == NULL);
+	arena_free(&a);
+	assert(a.base == NULL);
+	arena_free(&a);
+	assert(arena_init(&a, 0) == EXIT_SUCCESS);
+	assert(arena_alloc(&a, 0) == a.base && arena_alloc(&a, 1) == NULL);
+	arena_free(&a);
+	printf("test_alloc OK\n");
+}
+
+static void	test_strtrim(void)
+{
+	const char	*inputs[] = {"  a b \t\n", "path", " \t\n", "", "\tx"};
+	t_arena		a;
+	char		*mine;
+	char		*ref;
+	size_t		i;
+
+	assert(arena_init(&a, 256) == EXIT_SUCCESS);
+	i = 0;
+	while (i < sizeof(inputs) / sizeof(inputs[0]))
+	{
+		mine = arena_strtrim(&a, inputs[i], " \t\n");
+		ref = ft_strtrim(inputs[i++], " \t\n");
+		assert(mine && strcmp(mine, ref) == 0);
+		free(ref);
+	}
+	assert(arena_strtrim(&a, "a very long string that cannot fit in the "
+			"arena block any more because it is far longer than what is "
+			"left of the two hundred and fifty six bytes once the five "
+			"trimmed strings above were copied in, each aligned", " ") == NULL);
+	arena_free(&a);
+	printf("test_strtrim OK\n");
+}
+
+static void	test_map_blocks(void)
+{
+	t_game	g;
+	size_t	bytes;
+	int		y;
+	int		i;
+
+	init_t_game(&g);
+	assert(parse_and_validate_cub("maps/valid/bricks_arena.cub", &g)
+		== EXIT_SUCCESS);
+	assert((char *)(g.map.grid + g.map.height) <= g.map.grid[0]);
+	y = 0;
+	while (++y < g.map.height)
+		assert(g.map.grid[y] == g.map.grid[y - 1] + g.map.stats.full_width
+			+ 1);
+	i = -1;
+	while (++i < HEADER_SIZE)
+		assert(!g.map.tex_paths[i] || (g.map.tex_paths[i] >= g.map.strings.base
+				&& g.map.tex_paths[i] < g.map.strings.base
+				+ g.map.strings.used));
+	assert(check_header_count("maps/valid/bricks_arena.cub", &bytes)
+		== EXIT_SUCCESS && g.map.strings.cap == bytes);
+	assert(g.map.strings.cap < 1024);
+	free_t_map(&g.map);
+	assert(!g.map.grid && !g.map.strings.base && !g.map.tex_paths[0]);
+	printf("test_map_blocks OK\n");
+}
+
+/**
+ * @brief A short path, then a longer one: the block grows and the first
+ *        path moves with it
+ */
+static void	test_strings_grow(void)
+{
+	t_map	map;
+	char	line[600];
+
+	memset(&map, 0, sizeof(map));
+	assert(arena_init(&map.strings, 8) == EXIT_SUCCESS);
+	assert(parse_header_line(&map, "NO ./maps/valid/bricks_arena.cub")
+		== EXIT_SUCCESS);
+	memset(line, '/', sizeof(line));
+	memcpy(line, "SO .", 4);
+	strcpy(line + sizeof(line) - 32, "maps/valid/bricks_arena.cub");
+	assert(parse_header_line(&map, line) == EXIT_SUCCESS);
+	assert(strcmp(map.tex_paths[ID_NO], "./maps/valid/bricks_arena.cub")
+		== 0 && strcmp(map.tex_paths[ID_SO], line + 3) == 0);
+	assert(map.tex_paths[ID_NO] >= map.strings.base
+		&& map.tex_paths[ID_SO] < map.strings.base + map.strings.used);
+	arena_free(&map.strings);
+	memset(&map, 0, sizeof(map));
+	assert(parse_header_line(&map, line) == EXIT_SUCCESS);
+	assert(parse_header_line(&map, "NO ./maps/valid/bricks_arena.cub")
+		== EXIT_SUCCESS);
+	assert(strcmp(map.tex_paths[ID_SO], line + 3) == 0);
+	arena_free(&map.strings);
+	printf("test_strings_grow OK\n");
+}
+
+/**
+ * @brief Allocations made by parse_map() on a rows x 40 map
+ */
+static long	load_allocs(int rows)
+{
+	t_map	map;
+	long	before[2];
+	long	after[2];
+	FILE	*f;
+	int		y;
+
+	f = fopen("/tmp/cub3d_arena_rows.cub", "w");
+	assert(f);
+	y = -1;
+	while (++y < rows)
+		fprintf(f, "1000000000000000000000000000000000000001\n");
+	fclose(f);
+	memset(&map, 0, sizeof(map));
+	alloc_counts(before);
+	assert(parse_map("/tmp/cub3d_arena_rows.cub", &map) == EXIT_SUCCESS);
+	alloc_counts(after);
+	assert(map.height == rows && map.width == 40);
+	free_map_grid(&map);
+	unlink("/tmp/cub3d_arena_rows.cub");
+	return (after[0] - before[0]);
+}
+
+static void	test_load_allocs(void)
+{
+	long	few;
+	long	more;
+	long	many;
+
+	few = load_allocs(8);
+	more = load_allocs(800);
+	many = load_allocs(80000);
+	printf("parse_map: %ld allocations for 8 rows, %ld for 800, %ld for "
+		"80000\n", few, more, many);
+	assert(few > 0 && few <= more && more <= many && many <= few + 2 * 10);
+	printf("test_load_allocs OK\n");
+}
+
+int	main(void)
+{
+	assert(chdir("..") == 0);
+	test_alloc();
+	test_strtrim();
+	test_map_blocks();
+	test_strings_grow();
+	test_load_allocs();
+	printf("All arena tests passed!\n");
+	return (0);
+}
@@ -52,7 +52,7 @@ int	main(void)
 	{
 		printf(CYN "Test %2zu: %s\n" RESET, i + 1, tests[i].description);
 		printf("Input file: %s\n", tests[i].file_path);
-		ret = check_header_count(tests[i].file_path);
+		ret = check_header_count(tests[i].file_path, NULL);
 		printf("Expected: ");
 		if (tests[i].expect_fail)
 			printf(RED "FAIL\n" RESET);
@@ -0,0 +1,174 @@
+/**
+ * @file test_check_mode.c
+ * @brief Tests the batch validator (./cub3D --check) and the reentrant
+ *        get_next_line_r() it relies on.
+ *
+ * Checks that:
+ *   - two get_next_line_r() readers on the same file do not mix lines
+ *   - reports are identical whatever the number of threads
+ *   - each FAIL line carries the error a normal launch prints
+ *   - files named on the command line are checked whatever their name
+ *   - symlinks to directories met in a tree are not followed, so a link
+ *     loop ends, while a symlinked directory on the command line is
+ *     still walked
+ *   - bad usage is refused
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_check_mode.c
+ *   Run:   ./bin/test_check_mode   (builds ../cub3D if needed)
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define REPORT_MAX 65536
+#define REPORT_1 "/tmp/cub3d_check_1.txt"
+#define REPORT_N "/tmp/cub3d_check_n.txt"
+
+/**
+ * @brief Reads a report file into one of two static buffers
+ */
+static char	*read_report(const char *path, int slot)
+{
+	static char	buf[2][REPORT_MAX];
+	FILE		*f;
+	size_t		len;
+
+	f = fopen(path, "r");
+	assert(f);
+	len = fread(buf[slot], 1, REPORT_MAX - 1, f);
+	fclose(f);
+	assert(len < REPORT_MAX - 1);
+	buf[slot][len] = '\0';
+	return (buf[slot]);
+}
+
+static void	test_gnl_r(void)
+{
+	t_gnl	a;
+	t_gnl	b;
+	char	*la;
+	char	*lb;
+
+	a = (t_gnl){.fd = open("maps/valid/bricks_arena.cub", O_RDONLY)};
+	b = (t_gnl){.fd = open("maps/valid/bricks_arena.cub", O_RDONLY)};
+	free(get_next_line_r(&a));
+	la = get_next_line_r(&a);
+	lb = get_next_line_r(&b);
+	free(lb);
+	lb = get_next_line_r(&b);
+	while (la && lb)
+	{
+		assert(strcmp(la, lb) == 0);
+		free(la);
+		free(lb);
+		la = get_next_line_r(&a);
+		lb = get_next_line_r(&b);
+	}
+	assert(!la && !lb);
+	gnl_release(&a);
+	gnl_release(&b);
+	close(a.fd);
+	close(b.fd);
+	printf("test_gnl_r OK\n");
+}
+
+static void	test_jobs(void)
+{
+	const char	*args = "maps maps maps maps maps maps maps maps";
+	char		cmd[256];
+	char		*one;
+
+	snprintf(cmd, sizeof(cmd), "./cub3D --check --jobs 1 %s > %s",
+		args, REPORT_1);
+	assert(WEXITSTATUS(system(cmd)) == EXIT_FAILURE);
+	one = read_report(REPORT_1, 0);
+	assert(strstr(one, "PASS\tmaps/valid/bricks_arena.cub\n"));
+	assert(strstr(one, "FAIL\tmaps/invalid/no_player.cub\t"
+			PLAYER_NONE "\n"));
+	snprintf(cmd, sizeof(cmd), "./cub3D --check --jobs 16 %s > %s",
+		args, REPORT_N);
+	assert(WEXITSTATUS(system(cmd)) == EXIT_FAILURE);
+	assert(strcmp(one, read_report(REPORT_N, 1)) == 0);
+	assert(system("./cub3D --check maps/valid > /dev/null") == 0);
+	printf("test_jobs OK\n");
+}
+
+/**
+ * @brief Compares each FAIL message with what ./cub3D <file> prints
+ */
+static void	test_messages(void)
+{
+	char	cmd[512];
+	char	*line;
+	char	*path;
+	char	*msg;
+	char	*save;
+
+	assert(system("./cub3D --check maps/invalid maps/invalid/invalid.ber > "
+			REPORT_1) != 0);
+	line = strtok_r(read_report(REPORT_1, 0), "\n", &save);
+	while (line && strncmp(line, "FAIL\t", 5) == 0)
+	{
+		path = line + 5;
+		msg = strchr(path, '\t');
+		*msg++ = '\0';
+		snprintf(cmd, sizeof(cmd), "./cub3D %s 2>&1 >/dev/null | tr -d '\\0'"
+			" | grep -v '^Error$' | paste -sd ';' | sed 's/;/; /g' > %s",
+			path, REPORT_N);
+		assert(system(cmd) == 0);
+		assert(strcmp(msg, strtok(read_report(REPORT_N, 1), "\n")) == 0);
+		line = strtok_r(NULL, "\n", &save);
+	}
+	assert(strstr(msg, FILENAME_EXTENSION));
+	assert(line && strcmp(line, "TOTAL\t14\tPASS\t0\tFAIL\t14") == 0);
+	printf("test_messages OK\n");
+}
+
+static void	test_usage(void)
+{
+	assert(system("./cub3D --check 2>/dev/null") != 0);
+	assert(system("./cub3D --check --jobs 0 maps 2>/dev/null") != 0);
+	assert(system("./cub3D --check --jobs 257 maps 2>/dev/null") != 0);
+	assert(system("./cub3D --check --jobs maps 2>/dev/null") != 0);
+	assert(system("./cub3D --check /missing.cub > " REPORT_1) != 0);
+	assert(strcmp(read_report(REPORT_1, 0), "FAIL\t/missing.cub\topen: "
+			"No such file or directory\nTOTAL\t1\tPASS\t0\tFAIL\t1\n") == 0);
+	printf("test_usage OK\n");
+}
+
+static void	test_symlink_loop(void)
+{
+	assert(system("rm -rf /tmp/cub3d_loop && mkdir -p /tmp/cub3d_loop/sub"
+			" && cp maps/valid/bricks_arena.cub /tmp/cub3d_loop/sub"
+			" && ln -s . /tmp/cub3d_loop/sub/self"
+			" && ln -s .. /tmp/cub3d_loop/sub/parent"
+			" && ln -s sub /tmp/cub3d_loop/link") == 0);
+	assert(system("timeout 10 ./cub3D --check /tmp/cub3d_loop > "
+			REPORT_1) == 0);
+	assert(strcmp(read_report(REPORT_1, 0), "PASS\t/tmp/cub3d_loop/sub/"
+			"bricks_arena.cub\nTOTAL\t1\tPASS\t1\tFAIL\t0\n") == 0);
+	assert(system("timeout 10 ./cub3D --check /tmp/cub3d_loop/link > "
+			REPORT_1) == 0);
+	assert(strcmp(read_report(REPORT_1, 0), "PASS\t/tmp/cub3d_loop/link/"
+			"bricks_arena.cub\nTOTAL\t1\tPASS\t1\tFAIL\t0\n") == 0);
+	assert(system("rm -rf /tmp/cub3d_loop") == 0);
+	printf("test_symlink_loop OK\n");
+}
+
+int	main(void)
+{
+	assert(chdir("..") == 0);
+	assert(system("make -s cub3D > /dev/null") == 0);
+	test_gnl_r();
+	test_jobs();
+	test_messages();
+	test_usage();
+	test_symlink_loop();
+	unlink(REPORT_1);
+	unlink(REPORT_N);
+	printf("All check mode tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file test_frame_allocs.c
+ * @brief Tests that the frame loop runs without heap allocations.
+ *
+ * Linked with the counting allocator hooks (src/debug/alloc_hooks.c).
+ * After a first frame, in every render mode, counts the allocator calls
+ * as game_loop() does, from the end of one frame to the end of the next,
+ * so each window holds a whole event-loop round. It checks that:
+ *   - key presses and releases (bound, unbound and B), bursts of mouse
+ *     moves and the actions they start call neither malloc(), calloc(),
+ *     realloc() nor free()
+ *   - neither does rendering a frame (run_frame()), at any render scale
+ *
+ * Runs headless, with the synthetic textures of render_fixture.c, as
+ * test_golden.c does.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_frame_allocs.c
+ *   Run:   ./bin/test_frame_allocs
+ */
+#include "render_fixture.h"
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define FRAMES 120
+#define MAP_PATH "maps/valid/bricks_arena.cub"
+
+static const t_render_mode	g_modes[] = {
+{.name = "plain"},
+{.name = "spans", .spans = true},
+{.name = "aa3", .aa = 3},
+{.name = "bilinear", .bilinear = true},
+{.name = "palette", .palette = true},
+{.name = "fog", .fog = 6.0},
+{.name = NULL}
+};
+
+/**
+ * @brief The hooks must be linked in, or every count below is 0
+ */
+static void	test_hooks(void)
+{
+	long	before[2];
+	long	after[2];
+	void	*p;
+
+	alloc_counts(before);
+	p = malloc(16);
+	p = realloc(p, 32);
+	free(p);
+	free(calloc(4, 4));
+	alloc_counts(after);
+	assert(after[0] - before[0] == 3 && after[1] - before[1] == 2);
+	printf("test_hooks OK\n");
+}
+
+/**
+ * @brief One round of input, as mlx dispatches it between two frames: a
+ *        few keys held or released, a burst of mouse moves (one at the
+ *        window edge), now and then a render scale change
+ */
+static void	send_events(t_game *g, int frame)
+{
+	const int	keys[] = {XK_w, XK_a, XK_s, XK_d, XK_Left, XK_Right, XK_b,
+		XK_q};
+	int			key;
+	int			i;
+
+	key = keys[frame % 8];
+	if (frame % 2)
+		handle_keyrelease(key, g);
+	else
+		handle_keypress(key, g);
+	handle_keypress(keys[(frame + 3) % 6], g);
+	i = -1;
+	while (++i < 4)
+		handle_mouse_move(FIXTURE_W / 2 + (frame % 11) * 5 - i * 7, FIXTURE_H / 2
+			+ i, g);
+	handle_mouse_move(FIXTURE_W - 1, FIXTURE_H / 2, g);
+	if (frame % 10 == 0)
+		set_render_level(g, RENDER_SCALE_MIN
+			+ frame / 10 % (RENDER_SCALE_DEN - RENDER_SCALE_MIN + 1));
+}
+
+static void	test_mode(t_game *g, const t_render_mode *mode)
+{
+	long	before[2];
+	long	after[2];
+	int		frame;
+
+	setup_render_fixture(g, MAP_PATH, mode);
+	run_frame(g);
+	alloc_counts(before);
+	frame = 0;
+	while (++frame <= FRAMES)
+	{
+		send_events(g, frame);
+		run_frame(g);
+		alloc_counts(after);
+		if (after[0] != before[0] || after[1] != before[1])
+			printf("%s: frame %d: %ld allocations, %ld frees\n", mode->name,
+				frame, after[0] - before[0], after[1] - before[1]);
+		assert(after[0] == before[0] && after[1] == before[1]);
+		alloc_counts(before);
+	}
+	teardown_render_fixture(g);
+	printf("test_mode %s OK (%d frames)\n", mode->name, FRAMES);
+}
+
+int	main(void)
+{
+	static t_game	game;
+	int				i;
+
+	assert(chdir("..") == 0);
+	test_hooks();
+	i = -1;
+	while (g_modes[++i].name)
+		test_mode(&game, &g_modes[i]);
+	printf("All frame allocation tests passed!\n");
+	return (0);
+}
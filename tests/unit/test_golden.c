@@ -0,0 +1,424 @@
+/**
+ * @file test_golden.c
+ * @brief Golden-frame regression suite for the renderer.
+ *
+ * Renders a fixed set of camera poses on every map of maps/valid, once
+ * per render mode (plain, --spans, --aa, --bilinear, --palette, --fog,
+ * --max-dist and two reduced render scales), and hashes each window
+ * image (FNV-1a, 64 bits). Every hash must match its entry in
+ * tests/golden/frames.txt, and every kernel variant this CPU runs (see
+ * --force-isa) must give the same frame as the scalar one.
+ *
+ * On a mismatch the frame is written to tests/golden/diff/<key>.ppm:
+ * the frame, then the reference frame and a mask of the differing
+ * pixels when a reference is known. For a kernel variant the reference
+ * is the scalar frame; for the scalar frame it is
+ * tests/golden/ref/<key>.ppm, if frames were saved from a good build.
+ *
+ * Runs headless: wall, floor and ceiling textures are synthetic pixel
+ * buffers (render_fixture.c), so frames do not depend on the .xpm files.
+ *
+ * Usage:
+ *   Build:  make build TEST=unit/test_golden.c
+ *   Run:    ./bin/test_golden
+ *   Update: GOLDEN_UPDATE=1 ./bin/test_golden   (rewrites frames.txt)
+ *   Save:   GOLDEN_SAVE=1 ./bin/test_golden     (fills tests/golden/ref)
+ */
+#include "render_fixture.h"
+#include <assert.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define POSES 3
+#define POSE_ANGLE 2.39996
+#define MAPS_MAX 64
+#define GOLDEN_MAX 1024
+#define KEY_LEN 96
+#define GOLDEN_FILE "tests/golden/frames.txt"
+#define DIFF_DIR "tests/golden/diff"
+#define REF_DIR "tests/golden/ref"
+
+typedef struct s_golden
+{
+	char				key[GOLDEN_MAX][KEY_LEN];
+	unsigned long long	hash[GOLDEN_MAX];
+	int					count;
+	int					mismatches;
+	bool				update;
+	bool				save;
+}	t_golden;
+
+static const t_render_mode	g_modes[] = {
+{.name = "plain"},
+{.name = "spans", .spans = true},
+{.name = "aa3", .aa = 3},
+{.name = "bilinear", .bilinear = true},
+{.name = "palette", .palette = true},
+{.name = "fog", .fog = 6.0},
+{.name = "max_dist", .max_dist = 4.0},
+{.name = "half", .level = RENDER_SCALE_DEN / 2},
+{.name = "scale6", .level = 6},
+{.name = NULL}
+};
+
+static unsigned int	g_scalar[FIXTURE_W * FIXTURE_H];
+static t_golden		g_golden;
+
+/**
+ * @brief Finds open cell number n (or counts them all, with n = -1)
+ *
+ * @return Number of open cells seen before stopping
+ */
+static int	find_open(t_game *g, int n)
+{
+	int	open;
+	int	x;
+	int	y;
+
+	open = 0;
+	y = -1;
+	while (++y < g->map.height)
+	{
+		x = -1;
+		while (g->map.grid[y][++x])
+		{
+			if (!ft_strchr("0NSEW", g->map.grid[y][x]))
+				continue ;
+			if (open++ == n)
+			{
+				g->player.pos_x = x + 0.5;
+				g->player.pos_y = y + 0.25;
+				return (open);
+			}
+		}
+	}
+	return (open);
+}
+
+/**
+ * @brief Places the player for pose n
+ *
+ * Pose 0 is the spawn point. The others stand in open cells spread over
+ * the map, each turned by a different angle from the spawn direction.
+ */
+static void	set_pose(t_game *g, const t_player *spawn, int n)
+{
+	g->player = *spawn;
+	if (n == 0)
+		return ;
+	find_open(g, find_open(g, -1) * n / POSES);
+	apply_camera_rotation(g, n * POSE_ANGLE);
+}
+
+static unsigned long long	frame_hash(const unsigned int *px)
+{
+	unsigned long long	hash;
+	const unsigned char	*byte;
+	size_t				i;
+
+	hash = 14695981039346656037ULL;
+	byte = (const unsigned char *)px;
+	i = 0;
+	while (i < sizeof(unsigned int) * FIXTURE_W * FIXTURE_H)
+	{
+		hash ^= byte[i++];
+		hash *= 1099511628211ULL;
+	}
+	return (hash);
+}
+
+static void	put_rgb(FILE *f, unsigned int px)
+{
+	fputc((px >> 16) & 0xFF, f);
+	fputc((px >> 8) & 0xFF, f);
+	fputc(px & 0xFF, f);
+}
+
+/**
+ * @brief Writes px as PPM, followed on the right by ref and a mask
+ *
+ * The mask shows differing pixels in red over a dimmed ref.
+ *
+ * @param ref Reference frame, NULL to write px alone
+ */
+static void	write_ppm(const char *path, const unsigned int *px,
+		const unsigned int *ref)
+{
+	FILE	*f;
+	int		x;
+	int		y;
+
+	f = fopen(path, "wb");
+	assert(f);
+	fprintf(f, "P6\n%d %d\n255\n", FIXTURE_W * (1 + 2 * (ref != NULL)), FIXTURE_H);
+	y = -1;
+	while (++y < FIXTURE_H)
+	{
+		x = -1;
+		while (++x < FIXTURE_W)
+			put_rgb(f, px[y * FIXTURE_W + x]);
+		x = -1;
+		while (ref && ++x < FIXTURE_W)
+			put_rgb(f, ref[y * FIXTURE_W + x]);
+		x = -1;
+		while (ref && ++x < FIXTURE_W)
+		{
+			if (px[y * FIXTURE_W + x] != ref[y * FIXTURE_W + x])
+				put_rgb(f, 0xFF0000);
+			else
+				put_rgb(f, (ref[y * FIXTURE_W + x] >> 2) & 0x3F3F3F);
+		}
+	}
+	fclose(f);
+}
+
+/**
+ * @brief Reads a frame written by write_ppm() without a reference
+ *
+ * @return true if path holds a frame of the test size
+ */
+static bool	read_ppm(const char *path, unsigned int *px)
+{
+	FILE			*f;
+	unsigned char	rgb[3];
+	int				size[2];
+	int				i;
+
+	f = fopen(path, "rb");
+	if (!f)
+		return (false);
+	i = -1;
+	if (fscanf(f, "P6 %d %d 255", &size[0], &size[1]) == 2
+		&& size[0] == FIXTURE_W && size[1] == FIXTURE_H && fgetc(f) == '\n')
+	{
+		while (++i < FIXTURE_W * FIXTURE_H && fread(rgb, 1, 3, f) == 3)
+			px[i] = rgb[0] << 16 | rgb[1] << 8 | rgb[2];
+	}
+	fclose(f);
+	return (i == FIXTURE_W * FIXTURE_H);
+}
+
+static void	load_golden(void)
+{
+	FILE				*f;
+	char				line[KEY_LEN + 32];
+	char				*space;
+	t_golden			*gd;
+
+	gd = &g_golden;
+	f = fopen(GOLDEN_FILE, "r");
+	assert(f || gd->update);
+	while (f && fgets(line, sizeof(line), f))
+	{
+		space = strrchr(line, ' ');
+		if (line[0] == '#' || !space)
+			continue ;
+		assert(gd->count < GOLDEN_MAX && space - line < KEY_LEN);
+		*space = '\0';
+		strcpy(gd->key[gd->count], line);
+		gd->hash[gd->count++] = strtoull(space + 1, NULL, 16);
+	}
+	if (f)
+		fclose(f);
+}
+
+/**
+ * @brief Golden hash of a key, or adds it in update mode
+ *
+ * @return Index of the key, -1 if it has no golden hash
+ */
+static int	golden_index(const char *key, unsigned long long hash)
+{
+	int	i;
+
+	i = 0;
+	while (i < g_golden.count && strcmp(g_golden.key[i], key))
+		i++;
+	if (i < g_golden.count)
+	{
+		if (g_golden.update)
+			g_golden.hash[i] = hash;
+		return (i);
+	}
+	if (!g_golden.update)
+		return (-1);
+	assert(i < GOLDEN_MAX);
+	strcpy(g_golden.key[i], key);
+	g_golden.hash[g_golden.count++] = hash;
+	return (i);
+}
+
+static void	save_golden(void)
+{
+	FILE	*f;
+	int		i;
+
+	f = fopen(GOLDEN_FILE, "w");
+	assert(f);
+	fprintf(f, "# map pose mode hash, written by GOLDEN_UPDATE=1 "
+		"./bin/test_golden\n");
+	i = -1;
+	while (++i < g_golden.count)
+		fprintf(f, "%s %016llx\n", g_golden.key[i], g_golden.hash[i]);
+	fclose(f);
+}
+
+/**
+ * @brief Reports a frame that does not match, with its diff image
+ */
+static void	mismatch(const char *key, const char *isa, const unsigned int *px,
+		const unsigned int *ref)
+{
+	static unsigned int	saved[FIXTURE_W * FIXTURE_H];
+	char				path[KEY_LEN + 64];
+	int					i;
+
+	snprintf(path, sizeof(path), REF_DIR "/%s.ppm", key);
+	i = -1;
+	while (path[++i])
+		if (path[i] == ' ')
+			path[i] = '_';
+	if (!ref && read_ppm(path, saved))
+		ref = saved;
+	snprintf(path, sizeof(path), DIFF_DIR "/%s %s.ppm", key, isa);
+	i = -1;
+	while (path[++i])
+		if (path[i] == ' ')
+			path[i] = '_';
+	mkdir(DIFF_DIR, 0755);
+	write_ppm(path, px, ref);
+	fprintf(stderr, "MISMATCH %s [%s], see %s\n", key, isa, path);
+	g_golden.mismatches++;
+}
+
+/**
+ * @brief Renders the current pose with every kernel variant and checks it
+ *
+ * The scalar frame is checked against the golden hash, the others
+ * against the scalar frame.
+ */
+static void	check_pose(t_game *g, const char *key)
+{
+	unsigned int	*px;
+	t_isa			isa;
+	int				i;
+
+	px = (unsigned int *)g->img_addr;
+	isa = ISA_SCALAR - 1;
+	while (++isa < ISA_COUNT)
+	{
+		if (!isa_supported(isa))
+			continue ;
+		assert(kernel_table(isa, kernels()));
+		render_frame(g);
+		upscale_frame(g);
+		if (isa != ISA_SCALAR)
+		{
+			if (memcmp(px, g_scalar, sizeof(g_scalar)))
+				mismatch(key, isa_name(isa), px, g_scalar);
+			continue ;
+		}
+		memcpy(g_scalar, px, sizeof(g_scalar));
+		i = golden_index(key, frame_hash(px));
+		if (i < 0 || g_golden.hash[i] != frame_hash(px))
+			mismatch(key, isa_name(isa), px, NULL);
+	}
+}
+
+/**
+ * @brief Checks every pose of one map in one render mode
+ */
+static void	check_map(const char *name, const t_render_mode *mode)
+{
+	char		path[KEY_LEN];
+	char		key[KEY_LEN];
+	t_game		g;
+	t_player	spawn;
+	int			pose;
+
+	snprintf(path, sizeof(path), "maps/valid/%s", name);
+	setup_render_fixture(&g, path, mode);
+	spawn = g.player;
+	pose = -1;
+	while (++pose < POSES)
+	{
+		set_pose(&g, &spawn, pose);
+		snprintf(key, sizeof(key), "%s %d %s", name, pose, mode->name);
+		check_pose(&g, key);
+		if (!g_golden.save)
+			continue ;
+		snprintf(path, sizeof(path), REF_DIR "/%s_%d_%s.ppm", name, pose,
+			mode->name);
+		mkdir(REF_DIR, 0755);
+		write_ppm(path, g_scalar, NULL);
+	}
+	teardown_render_fixture(&g);
+}
+
+static int	compare_names(const void *a, const void *b)
+{
+	return (strcmp(*(char *const *)a, *(char *const *)b));
+}
+
+/**
+ * @brief Lists the .cub files of maps/valid in name order
+ */
+static int	list_maps(char **names)
+{
+	DIR				*dir;
+	struct dirent	*entry;
+	int				count;
+
+	dir = opendir("maps/valid");
+	assert(dir);
+	count = 0;
+	entry = readdir(dir);
+	while (entry)
+	{
+		if (ft_strlen(entry->d_name) > 4 && !strcmp(entry->d_name
+				+ ft_strlen(entry->d_name) - 4, ".cub"))
+		{
+			assert(count < MAPS_MAX);
+			names[count++] = strdup(entry->d_name);
+		}
+		entry = readdir(dir);
+	}
+	closedir(dir);
+	qsort(names, count, sizeof(char *), compare_names);
+	return (count);
+}
+
+int	main(void)
+{
+	char	*names[MAPS_MAX];
+	t_isa	best;
+	int		count;
+	int		i;
+	int		m;
+
+	assert(chdir("..") == 0);
+	g_golden.update = getenv("GOLDEN_UPDATE") != NULL;
+	g_golden.save = getenv("GOLDEN_SAVE") != NULL;
+	load_golden();
+	best = kernels()->isa;
+	count = list_maps(names);
+	i = -1;
+	while (++i < count)
+	{
+		m = -1;
+		while (g_modes[++m].name)
+			check_map(names[i], &g_modes[m]);
+		printf("%-40s %d frames OK\n", names[i], m * POSES);
+		free(names[i]);
+	}
+	assert(kernel_table(best, kernels()));
+	if (g_golden.update)
+		save_golden();
+	assert(g_golden.mismatches == 0);
+	printf("All golden frames match (%d, up to %s)!\n", g_golden.count,
+		isa_name(best));
+	return (0);
+}
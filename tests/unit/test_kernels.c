@@ -0,0 +1,214 @@
+/**
+ * @file test_kernels.c
+ * @brief Unit tests for the render kernel variants and their dispatch.
+ *
+ * For every instruction set this CPU runs, checks that row fill, row
+ * copy, 2x row upscale and the bilinear and nearest wall samplers give
+ * exactly the scalar result, for every length and alignment around the
+ * vector widths. Then checks --force-isa (parse_isa()) and prints the speed of
+ * each variant.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_kernels.c
+ *   Run:   ./bin/test_kernels
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ROW_MAX 80
+#define GUARD 0xDEADBEEF
+#define TEX_DIM 32
+#define BENCH_ROW 1920
+#define BENCH_ROUNDS 2000
+
+static unsigned int	g_src[ROW_MAX];
+static unsigned int	g_ref[2 * ROW_MAX + 1];
+static unsigned int	g_out[2 * ROW_MAX + 1];
+static unsigned int	g_tex[TEX_DIM * TEX_DIM];
+
+/**
+ * @brief Runs one row kernel of both tables on every length and offset
+ */
+static void	check_rows(const t_kernels *ref, const t_kernels *k)
+{
+	int	n;
+	int	off;
+
+	n = -1;
+	while (++n + 4 < ROW_MAX)
+	{
+		off = -1;
+		while (++off < 4)
+		{
+			memset(g_ref, 0xEE, sizeof(g_ref));
+			memset(g_out, 0xEE, sizeof(g_out));
+			ref->fill_row(g_ref + off, GUARD ^ n, n);
+			k->fill_row(g_out + off, GUARD ^ n, n);
+			ref->copy_row(g_ref + ROW_MAX, g_src + off, n);
+			k->copy_row(g_out + ROW_MAX, g_src + off, n);
+			assert(memcmp(g_ref, g_out, sizeof(g_ref)) == 0);
+			memset(g_out, 0xEE, sizeof(g_out));
+			memcpy(g_ref, g_out, sizeof(g_ref));
+			ref->upscale_row_2x(g_ref + off, g_src, n);
+			k->upscale_row_2x(g_out + off, g_src, n);
+			assert(memcmp(g_ref, g_out, sizeof(g_ref)) == 0);
+		}
+	}
+}
+
+/**
+ * @brief Draws magnified and minified wall spans with both tables
+ *
+ * The last spans sample a tall, narrow view of the texture, over more
+ * than BILINEAR_ROWS rows.
+ */
+static void	check_bilinear(const t_kernels *ref, const t_kernels *k)
+{
+	t_mip	mip;
+	t_span	span;
+	int		i;
+
+	mip = (t_mip){.pixels = g_tex, .width = TEX_DIM, .height = TEX_DIM,
+		.stride = TEX_DIM};
+	i = -1;
+	while (++i < 64)
+	{
+		if (i == 32)
+			mip = (t_mip){.pixels = g_tex, .width = 8,
+				.height = TEX_DIM * TEX_DIM / 8, .stride = 8};
+		span = (t_span){.dst = g_ref, .dst_stride = 1, .tex_x = i
+			% (mip.width - 1), .tex_fx = i * 4 + 4, .pos = i * 977 - 0x8000,
+			.step = (i + 1) * 2311};
+		span.count = fmin((((mip.height - 1L) << 16) - span.pos) / span.step,
+				ROW_MAX);
+		ref->sample_wall_bilinear(span, &mip);
+		span.dst = g_out;
+		k->sample_wall_bilinear(span, &mip);
+		assert(memcmp(g_ref, g_out, sizeof(unsigned int) * ROW_MAX) == 0);
+	}
+}
+
+/**
+ * @brief Draws wall spans from a power of two level with both tables
+ *
+ * Spans go up and down the texture, wrap around it many times, start
+ * before it and have every length around the gather width.
+ */
+static void	check_nearest(const t_kernels *ref, const t_kernels *k)
+{
+	t_mip	mip;
+	t_span	span;
+	int		i;
+
+	mip = (t_mip){.pixels = g_tex, .width = TEX_DIM, .height = TEX_DIM,
+		.stride = TEX_DIM, .row_shift = 5, .row_mask = TEX_DIM - 1};
+	i = -1;
+	while (++i < 96)
+	{
+		memset(g_ref, 0xEE, sizeof(g_ref));
+		memset(g_out, 0xEE, sizeof(g_out));
+		span = (t_span){.dst = g_ref, .dst_stride = 1 + i % 2, .count = i
+			% 40, .tex_x = i % TEX_DIM, .pos = (i - 48) * 40503L,
+			.step = (i % 3 - 1) * (i + 1) * 30011L + 1};
+		ref->sample_wall_nearest(span, &mip);
+		span.dst = g_out;
+		k->sample_wall_nearest(span, &mip);
+		assert(memcmp(g_ref, g_out, sizeof(g_ref)) == 0);
+	}
+}
+
+/**
+ * @brief Times the row kernels of a table on a full HD row, and the
+ *        wall samplers on 3x magnified wall spans
+ */
+static void	bench_rows(const t_kernels *k)
+{
+	static unsigned int	row[2 * BENCH_ROW];
+	const t_mip			mip = {.pixels = g_tex, .width = TEX_DIM,
+		.height = TEX_DIM, .stride = TEX_DIM, .row_shift = 5,
+		.row_mask = TEX_DIM - 1};
+	long				t[5];
+	int					i;
+
+	t[0] = get_time_us();
+	i = -1;
+	while (++i < BENCH_ROUNDS)
+		k->fill_row(row, i, 2 * BENCH_ROW);
+	t[1] = get_time_us();
+	i = -1;
+	while (++i < BENCH_ROUNDS)
+		k->upscale_row_2x(row, row + BENCH_ROW, BENCH_ROW);
+	t[2] = get_time_us();
+	i = -1;
+	while (++i < BENCH_ROUNDS * 2 * BENCH_ROW / (3 * TEX_DIM))
+		k->sample_wall_bilinear((t_span){.dst = row, .dst_stride = 1,
+			.count = 3 * TEX_DIM - 2, .tex_x = i % (TEX_DIM - 1),
+			.tex_fx = i % 257, .step = 0x10000 / 3}, &mip);
+	t[3] = get_time_us();
+	i = -1;
+	while (++i < BENCH_ROUNDS * 2 * BENCH_ROW / (3 * TEX_DIM))
+		k->sample_wall_nearest((t_span){.dst = row, .dst_stride = 1,
+			.count = 3 * TEX_DIM, .tex_x = i % TEX_DIM,
+			.step = 0x10000 / 3}, &mip);
+	t[4] = get_time_us();
+	printf("  fill %.3f, upscale 2x %.3f, bilinear %.3f, nearest %.3f ns/px\n",
+		(t[1] - t[0]) * 1000.0 / BENCH_ROUNDS / (2 * BENCH_ROW),
+		(t[2] - t[1]) * 1000.0 / BENCH_ROUNDS / (2 * BENCH_ROW),
+		(t[3] - t[2]) * 1000.0 / BENCH_ROUNDS / (2 * BENCH_ROW),
+		(t[4] - t[3]) * 1000.0 / BENCH_ROUNDS / (2 * BENCH_ROW));
+}
+
+static void	test_force_isa(void)
+{
+	t_isa	best;
+
+	best = kernels()->isa;
+	assert(isa_supported(ISA_SCALAR));
+	assert(parse_isa("neon") == EXIT_FAILURE);
+	assert(parse_isa("avx512") == EXIT_FAILURE);
+	assert(parse_isa("") == EXIT_FAILURE);
+	assert(kernels()->isa == best);
+	assert(parse_isa("scalar") == EXIT_SUCCESS);
+	assert(kernels()->isa == ISA_SCALAR);
+	assert(kernels()->fill_row == fill_row_scalar);
+	assert(parse_isa(isa_name(best)) == EXIT_SUCCESS);
+	assert(kernels()->isa == best);
+	printf("test_force_isa OK (default %s)\n", isa_name(best));
+}
+
+int	main(void)
+{
+	t_kernels	ref;
+	t_kernels	k;
+	t_isa		isa;
+	int			i;
+
+	i = -1;
+	while (++i < ROW_MAX)
+		g_src[i] = (unsigned int)i * 0x01020304u;
+	i = -1;
+	while (++i < TEX_DIM * TEX_DIM)
+		g_tex[i] = (unsigned int)i * 2654435761u;
+	assert(kernel_table(ISA_SCALAR, &ref));
+	isa = ISA_SCALAR;
+	while (isa < ISA_COUNT)
+	{
+		if (!isa_supported(isa))
+			printf("%-6s not supported here, skipped\n", isa_name(isa));
+		else
+		{
+			assert(kernel_table(isa, &k) && k.isa == isa);
+			check_rows(&ref, &k);
+			check_bilinear(&ref, &k);
+			check_nearest(&ref, &k);
+			printf("%-6s OK\n", isa_name(isa));
+			bench_rows(&k);
+		}
+		isa++;
+	}
+	test_force_isa();
+	printf("All kernel tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_map_reach.c
+ * @brief Tests the reachability analysis and crop run after validation
+ *        (flood_map(), crop_to_reachable()).
+ *
+ * For maps with padding, unreachable rooms or both, checks that:
+ *   - the statistics match values computed by hand
+ *   - the cropped grid is the matching window of the full grid
+ *   - the player stands on the same cell of that window
+ *   - the reachable cells fill the cropped grid up to its border: a new
+ *     flood fill finds the same cells, with a one cell margin
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_map_reach.c
+ *   Run:   ./bin/test_map_reach
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct s_reach_test
+{
+	const char	*path;
+	t_map_stats	stats;
+	int			width;
+	int			height;
+}	t_reach_test;
+
+/**
+ * @brief Loads a map as the game does, cropped or not
+ */
+static void	load(const char *path, t_game *g, bool crop)
+{
+	init_t_game(g);
+	if (strstr(path, "maps/valid/"))
+	{
+		if (crop)
+			assert(parse_and_validate_cub((char *)path, g) == EXIT_SUCCESS);
+		else
+			assert(check_header_count(path, NULL) == EXIT_SUCCESS
+				&& parse_header(path, &g->map) == EXIT_SUCCESS
+				&& load_valid_map(path, g) == EXIT_SUCCESS);
+		return ;
+	}
+	assert(load_valid_map(path, g) == EXIT_SUCCESS);
+	if (crop)
+		assert(crop_to_reachable(g) == EXIT_SUCCESS);
+}
+
+/**
+ * @brief Floods the cropped grid again: same reachable cells, and a
+ *        bounding box one cell away from each side
+ */
+static void	check_tight(t_game *g)
+{
+	t_map_stats	before;
+	int			box[4];
+
+	before = g->map.stats;
+	assert(flood_map(&g->map, (int)g->player.pos_x, (int)g->player.pos_y,
+			box) == EXIT_SUCCESS);
+	assert(g->map.stats.reachable == before.reachable);
+	assert(box[0] == 1 && box[1] == 1);
+	assert(box[2] == g->map.width - 2 && box[3] == g->map.height - 2);
+}
+
+static void	check_map(const t_reach_test *t)
+{
+	t_game	full;
+	t_game	g;
+	int		y;
+
+	load(t->path, &full, false);
+	load(t->path, &g, true);
+	printf("%-48s %4d of %4d open, %2d areas, %3d x %3d -> %3d x %3d\n",
+		t->path, g.map.stats.reachable, g.map.stats.open_cells,
+		g.map.stats.components, g.map.stats.full_width,
+		g.map.stats.full_height, g.map.width, g.map.height);
+	assert(memcmp(&g.map.stats, &t->stats, sizeof(t_map_stats)) == 0);
+	assert(g.map.width == t->width && g.map.height == t->height);
+	y = -1;
+	while (++y < g.map.height)
+	{
+		assert((int)strlen(g.map.grid[y]) == g.map.width);
+		assert(strncmp(g.map.grid[y], full.map.grid[y + g.map.stats.crop_y]
+				+ g.map.stats.crop_x, g.map.width) == 0);
+	}
+	assert(g.player.pos_x + g.map.stats.crop_x == full.player.pos_x);
+	assert(g.player.pos_y + g.map.stats.crop_y == full.player.pos_y);
+	assert(g.map.grid[(int)g.player.pos_y][(int)g.player.pos_x] == '0');
+	free_t_map(&full.map);
+	check_tight(&g);
+	free_t_map(&g.map);
+}
+
+int	main(void)
+{
+	const t_reach_test	tests[] = {
+	{"maps/valid/bricks_arena.cub", {756, 756, 1, 41, 31, 0, 0}, 41, 31},
+	{"maps/valid/bricks_pdf_map.cub", {199, 197, 3, 33, 14, 0, 0}, 33, 14},
+	{"maps/valid/clouds_cross.cub", {383, 96, 7, 33, 33, 12, 4}, 8, 25},
+	{"maps/valid/colors_100x100.cub", {4925, 4736, 42, 100, 100, 0, 0},
+		100, 100},
+	{"maps/valid/dino_weird_header_spacing.cub", {154, 89, 7, 31, 17, 0, 0},
+		23, 17},
+	{"maps/valid/sky_pdf_map.cub", {198, 21, 4, 33, 14, 24, 5}, 5, 9},
+	{"maps/valid/twin_peaks_spaceship_map.cub", {87, 87, 1, 31, 9, 7, 0},
+		24, 9},
+	{"maps/test_maps/spaceshift_map.cub", {87, 87, 1, 31, 9, 7, 0}, 24, 9},
+	{"maps/test_maps/split_map.cub", {183, 21, 6, 33, 14, 24, 5}, 5, 9},
+	};
+	size_t				i;
+
+	assert(chdir("..") == 0);
+	i = 0;
+	while (i < sizeof(tests) / sizeof(tests[0]))
+		check_map(&tests[i++]);
+	printf("All map reach tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,455 @@
+/**
+ * @file test_map_stream.c
+ * @brief Tests the streaming map validator (map_stream_push/finish) and
+ *        the loaders built on it.
+ *
+ * It checks:
+ *   - each error is reported on the row that causes it, not later
+ *   - load_valid_map() accepts exactly the maps the former pipeline
+ *     (parse_map + init_player + check_valid_map) accepts, with the same
+ *     grid and player, on every .cub file under maps/
+ *   - the same on 20000 random small maps
+ *   - validate_map_file() agrees with load_valid_map() without a grid
+ *   - the same on random tall maps, which load_valid_map() checks in
+ *     bands (check_map_bands()) past their first 2 * MAP_BAND_MIN_ROWS
+ *     rows, each with at most one defect
+ *   - on tall maps with two defects, both loaders report the same error:
+ *     the first one the stream meets, even when the band check finds it
+ *   - validate_map_file() applies the game's size cap, so --check fails
+ *     the maps the game will not load
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_map_stream.c
+ *   Run:   ./bin/test_map_stream
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_ROWS 8
+
+typedef struct s_stream_test
+{
+	const char	*rows[MAX_ROWS];
+	int			fail_row;
+	const char	*error;
+}	t_stream_test;
+
+/**
+ * @brief Pushes rows until one fails; fail_row is the failing push
+ *        (from 1), 0 for map_stream_finish() and -1 for a valid map
+ */
+static void	run_stream_test(const t_stream_test *t)
+{
+	t_map_stream	st;
+	t_error_log		log;
+	int				i;
+	int				failed;
+
+	map_stream_init(&st, MAX_MAP_W, MAX_MAP_H, MAP_TOO_LARGE);
+	memset(&log, 0, sizeof(log));
+	*error_log() = &log;
+	failed = -1;
+	i = 0;
+	while (failed < 0 && t->rows[i])
+	{
+		if (map_stream_push(&st, t->rows[i], strlen(t->rows[i])))
+			failed = i + 1;
+		i++;
+	}
+	if (failed < 0 && map_stream_finish(&st))
+		failed = 0;
+	*error_log() = NULL;
+	printf("%-14s %-8s row %2d: %s\n", t->rows[0], t->rows[1], failed,
+		log.msg);
+	assert(failed == t->fail_row);
+	assert(strcmp(log.msg, t->error) == 0);
+}
+
+static void	test_rows(void)
+{
+	char					wide[MAX_MAP_W + 2];
+	const t_stream_test		tests[] = {
+	{{"111", "1N1", "111"}, -1, ""},
+	{{"101", "1N1", "111"}, 2, MAP_ZERO_BORDER},
+	{{"111", "101", "1 1", "111"}, 3, MAP_ZERO_INVALID},
+	{{"1111", "1N01", "11"}, 3, MAP_ZERO_INVALID},
+	{{"111", "1N1", "10"}, 0, MAP_ZERO_BORDER},
+	{{"111", "1N1", "1X1", "111"}, 3, MAP_CHAR},
+	{{"111", "1N1", "1S1", "111"}, 3, PLAYER_MULTI},
+	{{"111", "101", "111"}, 0, PLAYER_NONE},
+	{{"1111", "11N1", "1 11", "1011", "1111"}, 4, MAP_SPACE},
+	{{" 111", "11N1", "1111"}, -1, ""},
+	{{"111", "1E1", "111", "", "111"}, -1, ""},
+	{{"111", wide}, 2, MAP_TOO_LARGE},
+	};
+	size_t					i;
+
+	memset(wide, '1', MAX_MAP_W + 1);
+	wide[MAX_MAP_W + 1] = '\0';
+	i = 0;
+	while (i < sizeof(tests) / sizeof(tests[0]))
+		run_stream_test(&tests[i++]);
+	printf("test_rows OK\n");
+}
+
+/**
+ * @brief Runs the former pipeline, which loads, then scans the grid twice
+ */
+static int	old_pipeline(const char *path, t_game *g)
+{
+	if (parse_map(path, &g->map) != EXIT_SUCCESS)
+		return (EXIT_FAILURE);
+	if (init_player(g) != EXIT_SUCCESS
+		|| check_valid_map(&g->map) != EXIT_SUCCESS)
+		return (free_map_grid(&g->map), EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+static void	compare_file(const char *path, int *valid)
+{
+	t_game	old;
+	t_game	new;
+	t_game	streamed;
+	int		y;
+	int		ok;
+
+	init_t_game(&old);
+	if (check_header_count(path, NULL) == EXIT_SUCCESS
+		&& parse_header(path, &old.map) != EXIT_SUCCESS)
+		return (free_t_map(&old.map));
+	new = old;
+	streamed = old;
+	ok = old_pipeline(path, &old) == EXIT_SUCCESS;
+	assert(ok == (load_valid_map(path, &new) == EXIT_SUCCESS));
+	assert(ok == (validate_map_file(path, &streamed) == EXIT_SUCCESS));
+	y = -1;
+	while (ok && ++y < old.map.height)
+		assert(strcmp(old.map.grid[y], new.map.grid[y]) == 0);
+	assert(!ok || (new.map.width == old.map.width
+			&& streamed.map.height == old.map.height
+			&& memcmp(&new.player, &old.player, sizeof(t_player)) == 0
+			&& memcmp(&streamed.player, &old.player, sizeof(t_player)) == 0));
+	*valid += ok;
+	free_map_grid(&old.map);
+	free_t_map(&new.map);
+}
+
+/**
+ * @brief Writes a random walled map to path: random cells inside, one
+ *        player, and sometimes a row cut short
+ */
+static void	write_random_map(const char *path, unsigned int *seed)
+{
+	const char	cells[] = "000001 ";
+	char		rows[7][9];
+	int			size[2];
+	int			i;
+	FILE		*f;
+
+	size[0] = 3 + rand_r(seed) % 6;
+	size[1] = 3 + rand_r(seed) % 5;
+	i = -1;
+	while (++i < size[0] * size[1])
+		rows[i / size[0]][i % size[0]] = cells[rand_r(seed) % 7];
+	i = -1;
+	while (++i < size[1])
+	{
+		memset(rows[i], '1', size[0] * (i == 0 || i == size[1] - 1));
+		rows[i][0] = '1';
+		rows[i][size[0] - 1] = '1';
+		rows[i][size[0] - (rand_r(seed) % 12 == 0)] = '\0';
+	}
+	rows[1 + rand_r(seed) % (size[1] - 2)][1 + rand_r(seed) % (size[0] - 2)]
+		= "NSEW1"[rand_r(seed) % 5];
+	f = fopen(path, "w");
+	assert(f);
+	i = -1;
+	while (++i < size[1])
+		fprintf(f, "%s\n", rows[i]);
+	fclose(f);
+}
+
+/**
+ * @brief Compares both pipelines on many random maps
+ */
+static void	test_random_maps(void)
+{
+	unsigned int	seed;
+	int				i;
+	int				valid;
+	int				stderr_fd;
+
+	seed = 42;
+	valid = 0;
+	stderr_fd = dup(STDERR_FILENO);
+	freopen("/dev/null", "w", stderr);
+	i = 0;
+	while (i++ < 20000)
+	{
+		write_random_map("/tmp/cub3d_stream_test.cub", &seed);
+		compare_file("/tmp/cub3d_stream_test.cub", &valid);
+	}
+	dup2(stderr_fd, STDERR_FILENO);
+	close(stderr_fd);
+	unlink("/tmp/cub3d_stream_test.cub");
+	printf("20000 random maps, %d valid, same result as the former "
+		"pipeline\n", valid);
+	assert(valid > 0);
+	printf("test_random_maps OK\n");
+}
+
+static void	test_map_files(void)
+{
+	FILE	*list;
+	char	path[256];
+	int		count;
+	int		valid;
+	int		stderr_fd;
+
+	list = popen("find maps -name '*.cub' -type f | sort", "r");
+	assert(list);
+	stderr_fd = dup(STDERR_FILENO);
+	freopen("/dev/null", "w", stderr);
+	count = 0;
+	valid = 0;
+	while (fgets(path, sizeof(path), list))
+	{
+		path[strcspn(path, "\n")] = '\0';
+		compare_file(path, &valid);
+		count++;
+	}
+	pclose(list);
+	dup2(stderr_fd, STDERR_FILENO);
+	close(stderr_fd);
+	printf("%d files, %d valid maps, same result as the former pipeline\n",
+		count, valid);
+	assert(count > 50 && valid > 20);
+	printf("test_map_files OK\n");
+}
+
+/**
+ * @brief Writes a random tall walled map to path, sometimes with one
+ *        defect: a hole, a bad character or a second player
+ */
+static void	write_tall_map(const char *path, unsigned int *seed)
+{
+	char	row[32];
+	int		size[2];
+	int		bad[2];
+	int		y;
+	FILE	*f;
+
+	size[0] = 3 + rand_r(seed) % 28;
+	size[1] = 2 * MAP_BAND_MIN_ROWS - 4 + rand_r(seed) % 600;
+	bad[0] = rand_r(seed) % size[0];
+	bad[1] = rand_r(seed) % size[1];
+	f = fopen(path, "w");
+	assert(f);
+	y = -1;
+	while (++y < size[1])
+	{
+		memset(row, '0' + (y == 0 || y == size[1] - 1), size[0]);
+		row[0] = '1';
+		row[size[0] - 1] = '1';
+		row[size[0]] = '\0';
+		if (y == 1)
+			row[size[0] / 2] = 'N';
+		if (y == bad[1])
+			row[bad[0]] = " 0XS1"[rand_r(seed) % 5];
+		fprintf(f, "%s\n", row);
+	}
+	fclose(f);
+}
+
+/**
+ * @brief Compares both pipelines on tall maps, checked in bands
+ */
+static void	test_tall_maps(void)
+{
+	unsigned int	seed;
+	int				i;
+	int				valid;
+	int				stderr_fd;
+
+	seed = 7;
+	valid = 0;
+	stderr_fd = dup(STDERR_FILENO);
+	freopen("/dev/null", "w", stderr);
+	i = 0;
+	while (i++ < 300)
+	{
+		write_tall_map("/tmp/cub3d_tall_test.cub", &seed);
+		compare_file("/tmp/cub3d_tall_test.cub", &valid);
+	}
+	dup2(stderr_fd, STDERR_FILENO);
+	close(stderr_fd);
+	unlink("/tmp/cub3d_tall_test.cub");
+	printf("300 tall maps, %d valid, same result as the former pipeline\n",
+		valid);
+	assert(valid > 50 && valid < 300);
+	printf("test_tall_maps OK\n");
+}
+
+/**
+ * @brief Writes a closed 12 x 1000 map with the two defects ch[i] at
+ *        bad[i] = {x, y}
+ */
+static void	write_two_defect_map(const char *path, const int bad[2][2],
+	const char *ch)
+{
+	char	row[16];
+	int		y;
+	FILE	*f;
+
+	f = fopen(path, "w");
+	assert(f);
+	y = -1;
+	while (++y < 1000)
+	{
+		memset(row, '0' + (y == 0 || y == 999), 12);
+		row[0] = '1';
+		row[11] = '1';
+		row[12] = '\0';
+		if (y == 1)
+			row[6] = 'N';
+		if (y == bad[0][1])
+			row[bad[0][0]] = ch[0];
+		if (y == bad[1][1])
+			row[bad[1][0]] = ch[1];
+		fprintf(f, "%s\n", row);
+	}
+	fclose(f);
+}
+
+/**
+ * @brief Runs a loader on path and returns the error it prints
+ */
+static const char	*loader_error(const char *path,
+	int (*loader)(const char *, t_game *), t_error_log *log)
+{
+	t_game	g;
+
+	memset(log, 0, sizeof(*log));
+	*error_log() = log;
+	init_t_game(&g);
+	assert(loader(path, &g) == EXIT_FAILURE);
+	*error_log() = NULL;
+	free_t_map(&g.map);
+	return (log->msg);
+}
+
+/**
+ * @brief Tall maps with two defects: the game and --check report the
+ *        same (first streamed) error, starting with a space at row 600
+ *        and an 'X' at row 900
+ */
+static void	test_two_defects(void)
+{
+	unsigned int	seed;
+	int				bad[2][2];
+	char			ch[2];
+	t_error_log		logs[2];
+	int				i;
+
+	seed = 11;
+	bad[0][0] = 5;
+	bad[0][1] = 600;
+	bad[1][0] = 3;
+	bad[1][1] = 900;
+	memcpy(ch, " X", 2);
+	i = -1;
+	while (++i < 200)
+	{
+		write_two_defect_map("/tmp/cub3d_two_test.cub",
+			(const int (*)[2])bad, ch);
+		assert(strcmp(loader_error("/tmp/cub3d_two_test.cub",
+					load_valid_map, &logs[0]),
+				loader_error("/tmp/cub3d_two_test.cub",
+					validate_map_file, &logs[1])) == 0);
+		assert(i > 0 || strcmp(logs[0].msg, MAP_ZERO_INVALID) == 0);
+		bad[i % 2][0] = 1 + rand_r(&seed) % 10;
+		bad[i % 2][1] = 2 + rand_r(&seed) % 996;
+		ch[i % 2] = " XS"[rand_r(&seed) % 3];
+	}
+	unlink("/tmp/cub3d_two_test.cub");
+	printf("test_two_defects OK\n");
+}
+
+/**
+ * @brief Writes a closed map of width x height cells, player in the
+ *        second row
+ */
+static void	write_sized_map(const char *path, int width, int height)
+{
+	FILE	*f;
+	char	*row;
+	int		y;
+
+	row = malloc(width + 1);
+	f = fopen(path, "w");
+	assert(row && f);
+	row[width] = '\0';
+	y = -1;
+	while (++y < height)
+	{
+		memset(row, '1', width);
+		if (y > 0 && y < height - 1)
+			memset(row + 1, '0', width - 2);
+		if (y == 1)
+			row[1] = 'N';
+		fprintf(f, "%s\n", row);
+	}
+	fclose(f);
+	free(row);
+}
+
+/**
+ * @brief Both loaders agree on a map of width x height cells
+ */
+static void	check_cap(int width, int height, int ok)
+{
+	t_game		g;
+	t_error_log	log;
+
+	write_sized_map("/tmp/cub3d_cap_test.cub", width, height);
+	memset(&log, 0, sizeof(log));
+	*error_log() = &log;
+	init_t_game(&g);
+	assert((load_valid_map("/tmp/cub3d_cap_test.cub", &g) == 0) == ok);
+	free_t_map(&g.map);
+	assert(ok || strcmp(log.msg, MAP_TOO_LARGE) == 0);
+	memset(&log, 0, sizeof(log));
+	init_t_game(&g);
+	assert((validate_map_file("/tmp/cub3d_cap_test.cub", &g) == 0) == ok);
+	assert(ok || strcmp(log.msg, MAP_TOO_LARGE) == 0);
+	assert(!ok || (g.map.width == width && g.map.height == height
+			&& g.player.pos_x == 1 + TILE_CENTER_OFFSET));
+	*error_log() = NULL;
+	unlink("/tmp/cub3d_cap_test.cub");
+}
+
+static void	test_stream_cap(void)
+{
+	check_cap(MAX_MAP_W, 3, 1);
+	check_cap(MAX_MAP_W + 1, 3, 0);
+	check_cap(3 * MAX_MAP_W, 3, 0);
+	check_cap(3, MAX_MAP_H, 1);
+	check_cap(3, MAX_MAP_H + 1, 0);
+	printf("test_stream_cap OK\n");
+}
+
+int	main(void)
+{
+	assert(chdir("..") == 0);
+	test_rows();
+	test_map_files();
+	test_random_maps();
+	test_tall_maps();
+	test_two_defects();
+	test_stream_cap();
+	printf("All map stream tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_mapgen.c
+ * @brief Checks the procedural map generator (./mapgen).
+ *
+ * For every layout, at odd, even and minimal sizes, checks that:
+ *   - the generated file passes parse_and_validate_cub()
+ *   - every open cell can be reached from the player
+ *   - the same seed gives the same file, and another seed another maze
+ *   - --pose puts the player where asked, and is refused on a wall
+ *   - sizes past MAX_MAP_W x MAX_MAP_H, the largest maps the game
+ *     loads, are refused
+ * Sizes include maps larger than 100 x 100, the game's former cap.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_mapgen.c
+ *   Run:   ./bin/test_mapgen   (builds ../mapgen if needed)
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OUT_A "/tmp/cub3d_mapgen_a.cub"
+#define OUT_B "/tmp/cub3d_mapgen_b.cub"
+#define FILE_MAX 16384
+
+static int	generate(const char *args, const char *out)
+{
+	char	cmd[256];
+
+	snprintf(cmd, sizeof(cmd), "./mapgen %s -o %s 2>/dev/null", args, out);
+	return (system(cmd));
+}
+
+static size_t	read_file(const char *path, char *buf)
+{
+	FILE	*f;
+	size_t	len;
+
+	f = fopen(path, "r");
+	assert(f);
+	len = fread(buf, 1, FILE_MAX, f);
+	fclose(f);
+	assert(len < FILE_MAX);
+	return (len);
+}
+
+/**
+ * @brief Counts the open cells reachable from (x, y), marking them
+ */
+static int	flood(t_map *map, int x, int y)
+{
+	int	count;
+
+	if (y < 0 || y >= map->height || x < 0 || x >= map->width
+		|| map->grid[y][x] != '0')
+		return (0);
+	map->grid[y][x] = '.';
+	count = 1 + flood(map, x + 1, y) + flood(map, x - 1, y);
+	return (count + flood(map, x, y + 1) + flood(map, x, y - 1));
+}
+
+/**
+ * @brief Loads a generated map and checks it is valid and connected
+ */
+static void	check_map(const char *args)
+{
+	t_game	g;
+	int		open;
+	int		x;
+	int		y;
+
+	assert(generate(args, OUT_A) == 0);
+	init_t_game(&g);
+	assert(parse_and_validate_cub(OUT_A, &g) == EXIT_SUCCESS);
+	open = 0;
+	y = -1;
+	while (++y < g.map.height)
+	{
+		x = -1;
+		while (++x < g.map.width)
+			open += (g.map.grid[y][x] == '0');
+	}
+	assert(flood(&g.map, g.player.pos_x, g.player.pos_y) == open);
+	free_t_map(&g.map);
+	printf("%-36s %5d open cells OK\n", args, open);
+}
+
+static void	test_layouts(void)
+{
+	const char	*layouts[] = {"arena", "pillars", "corridors", "maze",
+		"spiral", NULL};
+	const char	*sizes[] = {"3 3", "5 5", "41 23", "40 24", "100 100",
+		"301 203", NULL};
+	char		args[64];
+	int			i;
+	int			k;
+
+	i = -1;
+	while (layouts[++i])
+	{
+		k = -1;
+		while (sizes[++k])
+		{
+			snprintf(args, sizeof(args), "%s %s", layouts[i], sizes[k]);
+			check_map(args);
+		}
+	}
+}
+
+static void	test_seeds(void)
+{
+	static char	a[FILE_MAX];
+	static char	b[FILE_MAX];
+	size_t		len;
+
+	assert(generate("maze 61 61 --seed 7", OUT_A) == 0);
+	assert(generate("maze 61 61 --seed 7", OUT_B) == 0);
+	len = read_file(OUT_A, a);
+	assert(len == read_file(OUT_B, b) && !memcmp(a, b, len));
+	assert(generate("maze 61 61 --seed 8", OUT_B) == 0);
+	assert(len == read_file(OUT_B, b) && memcmp(a, b, len));
+	assert(generate("pillars 61 61 --seed 7 --textures sky", OUT_B) == 0);
+	read_file(OUT_B, b);
+	assert(strstr(b, "NO assets/textures/sky/NO.xpm\n"));
+	printf("test_seeds OK\n");
+}
+
+static void	test_pose(void)
+{
+	t_game	g;
+	char	args[64];
+
+	assert(generate("arena 20 10 --pose 3,7,W", OUT_A) == 0);
+	init_t_game(&g);
+	assert(parse_and_validate_cub(OUT_A, &g) == EXIT_SUCCESS);
+	assert(g.player.pos_x == 3.5 && g.player.pos_y == 7.5);
+	assert(g.player.dir_x == -1.0);
+	free_t_map(&g.map);
+	assert(generate("arena 20 10 --pose 0,7,W", OUT_A) != 0);
+	assert(generate("maze 21 21 --pose 2,2,N", OUT_A) != 0);
+	assert(generate("arena 20 10 --pose 3,7,X", OUT_A) != 0);
+	assert(generate("arena 2 10", OUT_A) != 0);
+	snprintf(args, sizeof(args), "arena %d 10", MAX_MAP_W + 1);
+	assert(generate(args, OUT_A) != 0);
+	snprintf(args, sizeof(args), "arena 10 %d", MAX_MAP_H + 1);
+	assert(generate(args, OUT_A) != 0);
+	assert(generate("dungeon 20 10", OUT_A) != 0);
+	assert(generate("arena 20 10 --textures stone", OUT_A) != 0);
+	printf("test_pose OK\n");
+}
+
+int	main(void)
+{
+	assert(chdir("..") == 0);
+	assert(system("make -s mapgen > /dev/null") == 0);
+	test_layouts();
+	test_seeds();
+	test_pose();
+	unlink(OUT_A);
+	unlink(OUT_B);
+	printf("All map generator tests passed!\n");
+	return (0);
+}
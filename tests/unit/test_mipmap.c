@@ -0,0 +1,244 @@
+/**
+ * @file test_mipmap.c
+ * @brief Unit tests for the wall texture mip chain and LOD selection.
+ *
+ * Checks the mip chain layout packed by build_texture_atlas(), the 2x2 box
+ * filter, the level picked by select_mip(), and compares a frame
+ * rendered with and without mipmaps down a long corridor:
+ *   - columns whose wall is at least as tall as the texture must be
+ *     pixel identical (they always sample level 0)
+ *   - the rest of the frame must stay within a small color tolerance
+ *
+ * Runs headless: textures are plain pixel buffers, no MLX connection.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_mipmap.c
+ *   Run:   ./bin/test_mipmap
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MIP_TEX_SIZE 64
+#define TEX_LEVELS 7
+#define TEST_W 320
+#define TEST_H 240
+#define CORRIDOR_LEN 64
+#define MEAN_DIFF_TOLERANCE 1.0
+#define MAX_DIFF_TOLERANCE 64
+
+static unsigned int	g_texels[MIP_TEX_SIZE * MIP_TEX_SIZE];
+
+/**
+ * @brief Fills the test texture with a smooth red/green gradient
+ */
+static void	make_gradient_texture(t_texture *tex)
+{
+	int	x;
+	int	y;
+
+	y = 0;
+	while (y < MIP_TEX_SIZE)
+	{
+		x = 0;
+		while (x < MIP_TEX_SIZE)
+		{
+			g_texels[y * MIP_TEX_SIZE + x] = (x * 4) << 16 | (y * 4) << 8
+				| 0x40;
+			x++;
+		}
+		y++;
+	}
+	memset(tex, 0, sizeof(*tex));
+	tex->addr = (char *)g_texels;
+	tex->width = MIP_TEX_SIZE;
+	tex->height = MIP_TEX_SIZE;
+	tex->bpp = 32;
+	tex->line_len = MIP_TEX_SIZE * 4;
+}
+
+static void	test_chain_layout(void)
+{
+	t_texture	tex;
+	t_atlas		atlas;
+	int			i;
+
+	make_gradient_texture(&tex);
+	assert(build_texture_atlas(&atlas, &tex, 1, NULL) == EXIT_SUCCESS);
+	assert(tex.mip_count == TEX_LEVELS);
+	i = 0;
+	while (i < tex.mip_count)
+	{
+		assert(tex.mips[i].width == MIP_TEX_SIZE >> i);
+		assert(tex.mips[i].height == MIP_TEX_SIZE >> i);
+		assert((unsigned long)tex.mips[i].pixels % ATLAS_ALIGN == 0);
+		i++;
+	}
+	assert((unsigned char *)tex.mips[0].pixels == atlas.data);
+	assert(memcmp(tex.mips[0].pixels, g_texels, sizeof(g_texels)) == 0);
+	assert(tex.mips[2].pixels == tex.mips[1].pixels + 32 * 32);
+	free_texture_atlas(&atlas);
+	printf("test_chain_layout OK\n");
+}
+
+static void	test_box_filter(void)
+{
+	t_texture	tex;
+	t_atlas		atlas;
+
+	make_gradient_texture(&tex);
+	g_texels[0] = 0xFF000000;
+	g_texels[1] = 0x00FF0000;
+	g_texels[MIP_TEX_SIZE] = 0x0000FF00;
+	g_texels[MIP_TEX_SIZE + 1] = 0x000000FF;
+	assert(build_texture_atlas(&atlas, &tex, 1, NULL) == EXIT_SUCCESS);
+	assert(tex.mips[1].pixels[0] == 0x40404040);
+	assert(tex.mips[1].pixels[1] == (0x0A << 16 | 0x02 << 8 | 0x40));
+	assert(tex.mips[TEX_LEVELS - 1].width == 1);
+	free_texture_atlas(&atlas);
+	printf("test_box_filter OK\n");
+}
+
+static void	test_select_mip(void)
+{
+	t_texture	tex;
+	t_atlas		atlas;
+
+	make_gradient_texture(&tex);
+	assert(build_texture_atlas(&atlas, &tex, 1, NULL) == EXIT_SUCCESS);
+	assert(select_mip(&tex, 500) == &tex.mips[0]);
+	assert(select_mip(&tex, 64) == &tex.mips[0]);
+	assert(select_mip(&tex, 33) == &tex.mips[0]);
+	assert(select_mip(&tex, 32) == &tex.mips[1]);
+	assert(select_mip(&tex, 20) == &tex.mips[1]);
+	assert(select_mip(&tex, 1) == &tex.mips[TEX_LEVELS - 1]);
+	tex.mip_count = 1;
+	assert(select_mip(&tex, 1) == &tex.mips[0]);
+	free_texture_atlas(&atlas);
+	printf("test_select_mip OK\n");
+}
+
+/**
+ * @brief Sets up a headless game looking down a long corridor
+ *
+ * The corridor is 1 cell wide and CORRIDOR_LEN cells long, so the view
+ * goes from walls taller than the screen down to a few pixels.
+ */
+static void	setup_corridor(t_game *g, char rows[3][CORRIDOR_LEN + 1],
+		char **grid)
+{
+	int	i;
+
+	memset(g, 0, sizeof(*g));
+	memset(rows[0], '1', CORRIDOR_LEN);
+	memset(rows[1], '0', CORRIDOR_LEN);
+	memset(rows[2], '1', CORRIDOR_LEN);
+	rows[1][0] = '1';
+	rows[1][1] = 'E';
+	rows[1][CORRIDOR_LEN - 1] = '1';
+	i = 0;
+	while (i < 3)
+	{
+		rows[i][CORRIDOR_LEN] = '\0';
+		grid[i] = rows[i];
+		i++;
+	}
+	g->map.grid = grid;
+	g->map.width = CORRIDOR_LEN;
+	g->map.height = 3;
+	g->map.floor_rgb = 0x202020;
+	g->map.ceiling_rgb = 0x808080;
+	assert(init_player(g) == EXIT_SUCCESS);
+	g->player.pos_y = 1.3;
+	g->win_w = TEST_W;
+	g->win_h = TEST_H;
+	g->img_addr = malloc(sizeof(unsigned int) * TEST_W * TEST_H);
+	g->img_line_len = TEST_W * 4;
+	assert(g->img_addr && init_render_scale(g) == EXIT_SUCCESS);
+}
+
+static int	channel_diff(unsigned int a, unsigned int b, int shift)
+{
+	return (abs((int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF)));
+}
+
+static void	test_render_tolerance(void)
+{
+	t_game			g;
+	char			rows[3][CORRIDOR_LEN + 1];
+	char			*grid[3];
+	unsigned int	*ref;
+	long			total;
+	int				max_diff;
+	int				near_cols;
+	int				i;
+	int				x;
+	int				y;
+	int				d;
+
+	setup_corridor(&g, rows, grid);
+	i = 0;
+	while (i < ID_FLOOR)
+		make_gradient_texture(&g.textures[i++]);
+	assert(build_texture_atlas(&g.atlas, g.textures, ID_FLOOR, NULL)
+		== EXIT_SUCCESS);
+	ref = malloc(sizeof(unsigned int) * TEST_W * TEST_H);
+	assert(ref);
+	i = 0;
+	while (i < ID_FLOOR)
+		g.textures[i++].mip_count = 1;
+	render_frame(&g);
+	memcpy(ref, g.frame.pixels, sizeof(unsigned int) * TEST_W * TEST_H);
+	i = 0;
+	while (i < ID_FLOOR)
+		g.textures[i++].mip_count = TEX_LEVELS;
+	render_frame(&g);
+	total = 0;
+	max_diff = 0;
+	near_cols = 0;
+	x = 0;
+	while (x < TEST_W)
+	{
+		if (g.frame.columns[x].line_height >= MIP_TEX_SIZE)
+			near_cols++;
+		y = 0;
+		while (y < TEST_H)
+		{
+			i = y * TEST_W + x;
+			if (g.frame.columns[x].line_height >= MIP_TEX_SIZE)
+				assert(g.frame.pixels[i] == ref[i]);
+			d = 0;
+			while (d < 24)
+			{
+				total += channel_diff(g.frame.pixels[i], ref[i], d);
+				if (channel_diff(g.frame.pixels[i], ref[i], d) > max_diff)
+					max_diff = channel_diff(g.frame.pixels[i], ref[i], d);
+				d += 8;
+			}
+			y++;
+		}
+		x++;
+	}
+	printf("near columns %d/%d, mean diff %.3f, max diff %d\n", near_cols,
+		TEST_W, (double)total / (TEST_W * TEST_H * 3), max_diff);
+	assert(near_cols > 0 && near_cols < TEST_W);
+	assert(max_diff > 0);
+	assert((double)total / (TEST_W * TEST_H * 3) <= MEAN_DIFF_TOLERANCE);
+	assert(max_diff <= MAX_DIFF_TOLERANCE);
+	free_texture_atlas(&g.atlas);
+	free(ref);
+	cleanup_render_scale(&g);
+	free(g.img_addr);
+	printf("test_render_tolerance OK\n");
+}
+
+int	main(void)
+{
+	test_chain_layout();
+	test_box_filter();
+	test_select_mip();
+	test_render_tolerance();
+	printf("All mipmap tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file test_outbuf.c
+ * @brief Tests the buffered output (libft's ft_outbuf_*) and the startup
+ *        prints built on it.
+ *
+ * write() is wrapped to count the calls. It checks that:
+ *   - bytes only reach the fd when the buffer is full or flushed
+ *   - ft_outbuf_putnbr() prints any long
+ *   - print_errors() prints its message with a single write
+ *   - print_map_grid() takes one write per FT_OUTBUF_SIZE bytes, not one
+ *     per cell, and prints what it used to
+ *   - --quiet and --verbose set the verbosity, and the map grid is only
+ *     printed with --verbose
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_outbuf.c
+ *   Run:   ./bin/test_outbuf
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+
+#define CAPTURE_SIZE 65536
+
+static long	g_writes;
+static char	g_capture[CAPTURE_SIZE];
+
+ssize_t	write(int fd, const void *buf, size_t n)
+{
+	g_writes++;
+	return (syscall(SYS_write, fd, buf, n));
+}
+
+/**
+ * @brief Points fd to a temporary file, or reads back what was written
+ *        to it since and puts fd back
+ *
+ * @return Number of bytes written to fd, when reading back
+ */
+static size_t	capture(int fd, bool start)
+{
+	static int	saved;
+	static FILE	*file;
+	size_t		len;
+
+	fflush(stdout);
+	if (start)
+	{
+		file = tmpfile();
+		saved = dup(fd);
+		assert(file && saved >= 0 && dup2(fileno(file), fd) == fd);
+		g_writes = 0;
+		return (0);
+	}
+	assert(dup2(saved, fd) == fd && close(saved) == 0);
+	rewind(file);
+	len = fread(g_capture, 1, CAPTURE_SIZE - 1, file);
+	g_capture[len] = '\0';
+	fclose(file);
+	return (len);
+}
+
+static void	test_buffer(void)
+{
+	t_outbuf	out;
+	int			i;
+	char		expected[64];
+
+	capture(STDOUT_FILENO, true);
+	ft_outbuf_init(&out, STDOUT_FILENO);
+	i = -1;
+	while (++i < 3 * FT_OUTBUF_SIZE + 5)
+		assert(ft_outbuf_putchar(&out, 'a' + i % 26) == 0);
+	assert(g_writes == 3 && out.len == 5);
+	assert(ft_outbuf_flush(&out) == 0 && g_writes == 4);
+	assert(ft_outbuf_flush(&out) == 0 && g_writes == 4);
+	ft_outbuf_putnbr(&out, 0);
+	ft_outbuf_putfield(&out, " ", -1);
+	ft_outbuf_putfield(&out, " ", LONG_MIN);
+	ft_outbuf_putfield(&out, " ", LONG_MAX);
+	ft_outbuf_putstr(&out, NULL);
+	assert(ft_outbuf_flush(&out) == 0);
+	assert(capture(STDOUT_FILENO, false) == 3 * FT_OUTBUF_SIZE + 5
+		+ (size_t)snprintf(expected, sizeof(expected), "0 -1 %ld %ld",
+			LONG_MIN, LONG_MAX));
+	assert(g_capture[FT_OUTBUF_SIZE] == 'a' + FT_OUTBUF_SIZE % 26);
+	assert(strcmp(g_capture + 3 * FT_OUTBUF_SIZE + 5, expected) == 0);
+	ft_outbuf_init(&out, -1);
+	ft_outbuf_putstr(&out, "lost");
+	assert(ft_outbuf_flush(&out) == -1 && out.error);
+	assert(ft_outbuf_putchar(&out, 'x') == -1);
+	printf("test_buffer OK\n");
+}
+
+static void	test_errors(void)
+{
+	capture(STDERR_FILENO, true);
+	print_errors("first ", NULL, "third");
+	assert(capture(STDERR_FILENO, false) == 18 && g_writes == 1);
+	assert(strcmp(g_capture, "Error\nfirst third\n") == 0);
+	printf("test_errors OK\n");
+}
+
+static void	test_map_grid(void)
+{
+	t_game	g;
+	size_t	len;
+	char	*row;
+	int		y;
+	int		x;
+
+	init_t_game(&g);
+	assert(parse_and_validate_cub("maps/valid/colors_100x100.cub", &g) == 0);
+	capture(STDOUT_FILENO, true);
+	print_map_grid(&g.map);
+	len = capture(STDOUT_FILENO, false);
+	assert(g_writes == (long)(len + FT_OUTBUF_SIZE - 1) / FT_OUTBUF_SIZE);
+	assert(strncmp(g_capture, MAG "Map dimensions: 100 x 100\n" RESET,
+			strlen(MAG RESET) + 26) == 0);
+	row = g_capture + strlen(MAG RESET) + 26;
+	y = -1;
+	while (++y < g.map.height)
+	{
+		x = -1;
+		while (++x < g.map.width)
+			assert(row[x] == g.map.grid[y][x]
+				|| (row[x] == '.' && g.map.grid[y][x] == ' '));
+		assert(row[x] == '\n');
+		row += x + 1;
+	}
+	assert(*row == '\0');
+	printf("test_map_grid OK (%zu bytes, %ld writes)\n", len, g_writes);
+	free_t_map(&g.map);
+}
+
+/**
+ * @brief Startup output of a map, for the given extra flag
+ *
+ * @return Number of bytes printed
+ */
+static size_t	startup_output(char *flag)
+{
+	char	*argv[] = {"cub3D", "maps/valid/bricks_arena.cub", flag, NULL};
+	t_game	g;
+
+	init_t_game(&g);
+	assert(parse_args(2 + (flag != NULL), argv, &g) == EXIT_SUCCESS);
+	assert(parse_and_validate_cub(argv[1], &g) == EXIT_SUCCESS);
+	capture(STDOUT_FILENO, true);
+	print_startup_info(&g);
+	free_t_map(&g.map);
+	return (capture(STDOUT_FILENO, false));
+}
+
+static void	test_verbosity(void)
+{
+	assert(startup_output(QUIET_FLAG) == 0 && g_writes == 0);
+	assert(startup_output(NULL) > 0 && g_writes == 2);
+	assert(strstr(g_capture, "Reachable cells: ")
+		&& !strstr(g_capture, "Map dimensions: "));
+	assert(startup_output(VERBOSE_FLAG) > 0 && g_writes == 3);
+	assert(strstr(g_capture, "Reachable cells: ")
+		&& strstr(g_capture, "Map dimensions: 41 x 31"));
+	printf("test_verbosity OK\n");
+}
+
+int	main(void)
+{
+	assert(chdir("..") == 0);
+	test_buffer();
+	test_errors();
+	test_map_grid();
+	test_verbosity();
+	printf("All outbuf tests passed!\n");
+	return (0);
+}
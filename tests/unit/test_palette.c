@@ -0,0 +1,175 @@
+/**
+ * @file test_palette.c
+ * @brief Unit tests for palettised (8-bit) wall textures.
+ *
+ * Checks palette collection, the atlas layout of palettised textures
+ * (1 byte per texel, shared color table), the sampler choice, and that
+ * wall slices drawn from a palettised texture match the 32-bit ones
+ * exactly at full size and only use palette colors at smaller levels.
+ *
+ * Runs headless: textures are plain pixel buffers, no MLX connection.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_palette.c
+ *   Run:   ./bin/test_palette
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FRAME_W 2
+#define FRAME_H 512
+
+/**
+ * @brief Fills a texture with a pattern of `colors` distinct colors
+ */
+static void	make_texture(t_texture *tex, int size, int colors,
+		unsigned int *pixels)
+{
+	int	i;
+
+	i = 0;
+	while (i < size * size)
+	{
+		pixels[i] = 0x10000 * (i % colors) + 0x3F * ((i / size) % 3);
+		i++;
+	}
+	memset(tex, 0, sizeof(*tex));
+	tex->addr = (char *)pixels;
+	tex->width = size;
+	tex->height = size;
+	tex->bpp = 32;
+	tex->line_len = size * 4;
+}
+
+static void	test_collect_palette(void)
+{
+	static unsigned int	pixels[64 * 64];
+	t_texture			tex;
+
+	make_texture(&tex, 64, 16, pixels);
+	assert(collect_palette(&tex));
+	assert(tex.palette_size == 16 * 3);
+	make_texture(&tex, 64, PALETTE_SIZE / 3, pixels);
+	assert(collect_palette(&tex));
+	assert(tex.palette_size <= PALETTE_SIZE);
+	make_texture(&tex, 64, 200, pixels);
+	assert(!collect_palette(&tex));
+	assert(tex.palette_size == 0);
+	printf("test_collect_palette OK\n");
+}
+
+static void	test_palette_atlas(void)
+{
+	static unsigned int	pixels[64 * 64];
+	t_texture			tex[2];
+	t_atlas				atlas;
+	int					i;
+
+	make_texture(&tex[0], 64, 16, pixels);
+	make_texture(&tex[1], 64, 16, pixels);
+	tex[0].palettise = true;
+	assert(build_texture_atlas(&atlas, tex, 2, NULL) == EXIT_SUCCESS);
+	assert(tex[0].palette_size == 48 && tex[1].palette_size == 0);
+	assert(tex[0].mips[0].indices && !tex[0].mips[0].pixels);
+	assert(tex[1].mips[0].pixels && !tex[1].mips[0].indices);
+	assert(tex[0].mips[0].sample == sample_wall_palette_pow2);
+	i = 0;
+	while (i < 64 * 64)
+	{
+		assert(tex[0].palette[tex[0].mips[0].indices[i]] == pixels[i]);
+		assert(tex[1].mips[0].pixels[i] == pixels[i]);
+		i++;
+	}
+	i = 0;
+	while (i < tex[0].mip_count)
+	{
+		assert((unsigned long)tex[0].mips[i].indices % ATLAS_ALIGN == 0);
+		assert(tex[0].mips[i].indices[0] < tex[0].palette_size);
+		i++;
+	}
+	free_texture_atlas(&atlas);
+	printf("test_palette_atlas OK\n");
+}
+
+static void	test_generic_sampler(void)
+{
+	static unsigned int	pixels[96 * 96];
+	t_texture			tex;
+	t_atlas				atlas;
+
+	make_texture(&tex, 96, 10, pixels);
+	tex.palettise = true;
+	assert(build_texture_atlas(&atlas, &tex, 1, NULL) == EXIT_SUCCESS);
+	assert(tex.mips[0].sample == sample_wall_palette_generic);
+	free_texture_atlas(&atlas);
+	printf("test_generic_sampler OK\n");
+}
+
+/**
+ * @brief Draws the same slice from a 32-bit and a palettised texture
+ */
+static void	compare_slice(t_game *g, int line_height, bool exact)
+{
+	static unsigned int	rgb[FRAME_W * FRAME_H];
+	t_draw_info			info;
+	int					y;
+
+	info = (t_draw_info){.x = 0, .draw_start = (FRAME_H - line_height) / 2,
+		.draw_end = (FRAME_H - line_height) / 2 + line_height - 1,
+		.line_height = line_height, .wall_dir = ID_SO, .wall_x = 0.3};
+	if (info.draw_start < 0)
+		info.draw_start = 0;
+	if (info.draw_end >= FRAME_H)
+		info.draw_end = FRAME_H - 1;
+	draw_textured_wall_slice(g, info);
+	memcpy(rgb, g->frame.pixels, sizeof(rgb));
+	info.wall_dir = ID_NO;
+	draw_textured_wall_slice(g, info);
+	y = info.draw_start;
+	while (y <= info.draw_end)
+	{
+		if (exact)
+			assert(g->frame.pixels[y * FRAME_W] == rgb[y * FRAME_W]);
+		assert(g->textures[ID_NO].palette[nearest_palette_index(
+					&g->textures[ID_NO], g->frame.pixels[y * FRAME_W])]
+			== g->frame.pixels[y * FRAME_W]);
+		y++;
+	}
+}
+
+static void	test_palette_matches_rgb(void)
+{
+	static unsigned int	pixels[64 * 64];
+	static unsigned int	frame[FRAME_W * FRAME_H];
+	t_game				g;
+
+	memset(&g, 0, sizeof(g));
+	g.frame.pixels = frame;
+	g.frame.width = FRAME_W;
+	g.frame.height = FRAME_H;
+	g.frame.stride = FRAME_W;
+	make_texture(&g.textures[ID_NO], 64, 16, pixels);
+	make_texture(&g.textures[ID_SO], 64, 16, pixels);
+	g.textures[ID_NO].palettise = true;
+	assert(build_texture_atlas(&g.atlas, g.textures, ID_FLOOR, NULL)
+		== EXIT_SUCCESS);
+	compare_slice(&g, 64, true);
+	compare_slice(&g, 300, true);
+	compare_slice(&g, 2000, true);
+	compare_slice(&g, 20, false);
+	compare_slice(&g, 3, false);
+	free_texture_atlas(&g.atlas);
+	printf("test_palette_matches_rgb OK\n");
+}
+
+int	main(void)
+{
+	test_collect_palette();
+	test_palette_atlas();
+	test_generic_sampler();
+	test_palette_matches_rgb();
+	printf("All palette tests passed!\n");
+	return (0);
+}
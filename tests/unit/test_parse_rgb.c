@@ -17,10 +17,17 @@
  *   - Too few or too many components
  *   - Non-integer or empty input
  *   - Inputs with extra whitespace
+ *   - Empty components, which are skipped as ft_split() skips them
+ *
+ * It also compares parse_rgb() with the ft_split() based parser it
+ * replaced, on random strings: same result, same values, same error.
  */
 #include "cub3d.h"
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
+
+#define RANDOM_TRIALS 200000
 
 typedef struct s_rgb_test
 {
@@ -29,6 +36,83 @@ typedef struct s_rgb_test
 	int			expect_fail;
 }	t_rgb_test;
 
+/**
+ * @brief The former parse_rgb(): ft_split() on commas, then
+ *        ft_safe_atoi() on each component
+ */
+static int	split_parse_rgb(const char *value, int rgb[3])
+{
+	char	**strs;
+	int		i;
+	int		status;
+
+	strs = ft_split(value, ',');
+	assert(strs);
+	status = EXIT_SUCCESS;
+	i = -1;
+	while (status == EXIT_SUCCESS && ++i < 3)
+	{
+		if (!strs[i] || !ft_safe_atoi(strs[i], &rgb[i])
+			|| rgb[i] < 0 || rgb[i] > 255)
+		{
+			print_errors(RGB_INVALID_FORMAT, NULL, NULL);
+			status = EXIT_FAILURE;
+		}
+	}
+	if (status == EXIT_SUCCESS && strs[3])
+	{
+		print_errors(RGB_TOO_MANY, NULL, NULL);
+		status = EXIT_FAILURE;
+	}
+	free_strings_array(strs);
+	return (status);
+}
+
+/**
+ * @brief Runs a parser with errors captured in log
+ */
+static int	run_logged(int (*parse)(const char *, int *), const char *value,
+		int rgb[3], t_error_log *log)
+{
+	int	status;
+
+	memset(log, 0, sizeof(*log));
+	*error_log() = log;
+	status = parse(value, rgb);
+	*error_log() = NULL;
+	return (status);
+}
+
+static void	test_against_split(void)
+{
+	const char		chars[] = "0123456789 ,,,+-\t\na";
+	char			value[16];
+	int				rgb[2][3];
+	t_error_log		log[2];
+	unsigned int	seed;
+	int				trial;
+	int				len;
+
+	seed = 42;
+	trial = 0;
+	while (trial++ < RANDOM_TRIALS)
+	{
+		len = rand_r(&seed) % 16;
+		value[len] = '\0';
+		while (len-- > 0)
+			value[len] = chars[rand_r(&seed) % (sizeof(chars) - 1)];
+		if (trial % 4 == 0)
+			snprintf(value, sizeof(value), "%d,%d,%d", rand_r(&seed) % 300,
+				rand_r(&seed) % 300 - 20, rand_r(&seed) % 300);
+		assert(run_logged(parse_rgb, value, rgb[0], &log[0])
+			== run_logged(split_parse_rgb, value, rgb[1], &log[1]));
+		assert(strcmp(log[0].msg, log[1].msg) == 0);
+		assert(log[0].len > 0 || memcmp(rgb[0], rgb[1], sizeof(rgb[0])) == 0);
+	}
+	printf("parse_rgb matches the ft_split parser on %d strings\n",
+		RANDOM_TRIALS);
+}
+
 static void	print_rgb(const int rgb[3])
 {
 	printf("[%d, %d, %d]", rgb[0], rgb[1], rgb[2]);
@@ -51,6 +135,12 @@ int	main(void)
 	{"abc,128,0",       {0,0,0},       1}, //non-integer input, fail
 	{"  255 , 128 ,0 ", {255,128,0},   0}, //spaces around values, valid
 	{"",                {0,0,0},       1}, //empty string, fail
+	{",,1,,2,3,",       {1,2,3},       0}, //empty components, valid
+	{"+1,-0,3\n",       {1,0,3},       0}, //signs and newline, valid
+	{"1,2,3,\n",        {0,0,0},       1}, //newline after a comma, fail
+	{"1 2,3,4",         {0,0,0},       1}, //space inside a value, fail
+	{"1, ,2,3",         {0,0,0},       1}, //blank component, fail
+	{"0000000000255,0,0", {255,0,0},   0}, //leading zeros, valid
 	};
 	// feel free to add more test cases to the table
 	num_tests = sizeof(tests) / sizeof(tests[0]);
@@ -90,6 +180,7 @@ int	main(void)
 			assert(ret == EXIT_FAILURE);
 		i++;
 	}
+	test_against_split();
 	printf("\nAll parse_rgb tests completed!\n");
 	return (0);
 }
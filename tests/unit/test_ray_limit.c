@@ -0,0 +1,175 @@
+/**
+ * @file test_ray_limit.c
+ * @brief Unit tests for the maximum ray distance (--max-dist).
+ *
+ * Checks that rays stop at the limit with a "far" result, that the fog
+ * distance caps the limit, that far columns are drawn in the sky color,
+ * and counts the DDA steps saved on a large open room. Also renders walls
+ * too far away to be one pixel high, which must still be drawn.
+ *
+ * Runs headless: no MLX connection, flat floor and ceiling colors.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_ray_limit.c
+ *   Run:   ./bin/test_ray_limit
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ROOM_SIZE 100
+#define MAX_DIST 10
+#define TEST_W 320
+#define TEST_H 240
+#define SKY_COLOR 0x6464C8
+
+static char			g_rows[ROOM_SIZE][ROOM_SIZE + 1];
+static char			*g_grid[ROOM_SIZE];
+static unsigned int	g_texels[16 * 16];
+
+/**
+ * @brief Sets up a headless game in the middle of an empty square room
+ *
+ * Walls use a plain 16x16 texture; the caller frees the atlas.
+ */
+static void	setup_room(t_game *g)
+{
+	int	i;
+
+	memset(g, 0, sizeof(*g));
+	i = 0;
+	while (i < ROOM_SIZE)
+	{
+		memset(g_rows[i], '0', ROOM_SIZE);
+		g_rows[i][0] = '1';
+		g_rows[i][ROOM_SIZE - 1] = '1';
+		if (i == 0 || i == ROOM_SIZE - 1)
+			memset(g_rows[i], '1', ROOM_SIZE);
+		g_rows[i][ROOM_SIZE] = '\0';
+		g_grid[i] = g_rows[i];
+		i++;
+	}
+	g_rows[ROOM_SIZE / 2][ROOM_SIZE / 2] = 'N';
+	g->map.grid = g_grid;
+	g->map.width = ROOM_SIZE;
+	g->map.height = ROOM_SIZE;
+	g->map.floor_rgb = 0x202020;
+	g->map.ceiling_rgb = SKY_COLOR;
+	assert(init_player(g) == EXIT_SUCCESS);
+	i = 0;
+	while (i < ID_FLOOR)
+	{
+		g->textures[i] = (t_texture){.addr = (char *)g_texels, .width = 16,
+			.height = 16, .bpp = 32, .line_len = 16 * 4};
+		i++;
+	}
+	assert(build_texture_atlas(&g->atlas, g->textures, ID_FLOOR, NULL)
+		== EXIT_SUCCESS);
+}
+
+static void	test_far_result(void)
+{
+	t_game			g;
+	t_ray_result	full;
+	t_ray_result	cut;
+
+	setup_room(&g);
+	full = cast_ray(&g, 1.0, 0.0);
+	assert(!full.far);
+	assert(fabs(full.wall_dist - (ROOM_SIZE / 2 - 1.5)) < 1e-9);
+	g.max_ray_dist = MAX_DIST;
+	cut = cast_ray(&g, 1.0, 0.0);
+	assert(cut.far && cut.wall_dist == MAX_DIST);
+	assert(cut.steps <= MAX_DIST + 1 && cut.steps < full.steps);
+	g.max_ray_dist = ROOM_SIZE * 2;
+	cut = cast_ray(&g, 1.0, 0.0);
+	assert(!cut.far && cut.steps == full.steps);
+	g.max_ray_dist = 0;
+	g.shade.fog_dist = MAX_DIST / 2;
+	assert(max_ray_distance(&g) == MAX_DIST / 2);
+	g.max_ray_dist = MAX_DIST / 4;
+	assert(max_ray_distance(&g) == MAX_DIST / 4);
+	free_texture_atlas(&g.atlas);
+	printf("test_far_result OK\n");
+}
+
+/**
+ * @brief Renders the room with and without the limit and compares
+ */
+static void	test_steps_saved(void)
+{
+	t_game	g;
+	long	full_steps;
+	int		x;
+
+	setup_room(&g);
+	g.win_w = TEST_W;
+	g.win_h = TEST_H;
+	g.img_addr = malloc(sizeof(unsigned int) * TEST_W * TEST_H);
+	g.img_line_len = TEST_W * 4;
+	assert(g.img_addr && init_render_scale(&g) == EXIT_SUCCESS);
+	render_frame(&g);
+	full_steps = g.frame.dda_steps;
+	g.max_ray_dist = MAX_DIST;
+	render_frame(&g);
+	printf("dda steps: %ld unlimited, %ld with max distance %d (%.1f%% saved)\n",
+		full_steps, g.frame.dda_steps, MAX_DIST,
+		100.0 * (full_steps - g.frame.dda_steps) / full_steps);
+	assert(g.frame.dda_steps < full_steps);
+	x = 0;
+	while (x < TEST_W)
+	{
+		assert(g.frame.columns[x].far);
+		assert(g.frame.pixels[TEST_H / 2 * TEST_W + x] == SKY_COLOR);
+		x++;
+	}
+	cleanup_render_scale(&g);
+	free_texture_atlas(&g.atlas);
+	free(g.img_addr);
+	printf("test_steps_saved OK\n");
+}
+
+/**
+ * @brief Walls under one pixel high: without a limit, a small frame and
+ *        a far wall give a slice of 1 pixel, never 0 (the texture step
+ *        divides by it)
+ */
+static void	test_far_wall(void)
+{
+	t_game			g;
+	t_draw_info		info;
+	t_ray_result	result;
+	int				x;
+
+	setup_room(&g);
+	g.win_w = 64;
+	g.win_h = 40;
+	g.img_addr = malloc(sizeof(unsigned int) * 64 * 40);
+	g.img_line_len = 64 * 4;
+	assert(g.img_addr && init_render_scale(&g) == EXIT_SUCCESS);
+	set_render_level(&g, RENDER_SCALE_MIN);
+	render_frame(&g);
+	x = -1;
+	while (++x < g.frame.width)
+		assert(!g.frame.columns[x].far && g.frame.columns[x].line_height == 1
+			&& g.frame.columns[x].draw_start == g.frame.columns[x].draw_end);
+	result = cast_ray(&g, 1.0, 0.0);
+	result.wall_dist = 1e9;
+	info = wall_column_info(&g, 0, result);
+	assert(info.line_height == 1
+		&& info.draw_start == (g.frame.height - 1) / 2);
+	cleanup_render_scale(&g);
+	free_texture_atlas(&g.atlas);
+	free(g.img_addr);
+	printf("test_far_wall OK\n");
+}
+
+int	main(void)
+{
+	test_far_result();
+	test_steps_saved();
+	test_far_wall();
+	printf("All ray limit tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file test_render_scale.c
+ * @brief Tests the dynamic resolution controller (update_render_scale(),
+ *        set_render_level()).
+ *
+ * Frame times are simulated: a frame costs its full resolution cost
+ * times the share of the pixels rendered at the current level. It checks
+ * that:
+ *   - a frame rate within budget keeps the full resolution
+ *   - one slow frame, however slow, drops exactly one level, and the
+ *     full resolution comes back once frames are fast again
+ *   - a lasting overload keeps dropping levels, down to RENDER_SCALE_MIN
+ *     and never below
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_render_scale.c
+ *   Run:   ./bin/test_render_scale
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define TEST_W 320
+#define TEST_H 180
+#define FRAMES 400
+#define SPIKE_AT 100
+
+static unsigned int	g_image[TEST_W * TEST_H];
+
+static void	setup(t_game *g)
+{
+	init_t_game(g);
+	g->win_w = TEST_W;
+	g->win_h = TEST_H;
+	g->img_addr = (char *)g_image;
+	g->img_line_len = TEST_W * 4;
+	assert(init_render_scale(g) == EXIT_SUCCESS);
+}
+
+/**
+ * @brief Runs FRAMES frames costing full_us at full resolution, except
+ *        spike_frames frames from SPIKE_AT costing spike_us
+ *
+ * @param levels Filled with the lowest and the last level reached
+ */
+static void	run(long full_us, long spike_us, int spike_frames, int levels[2])
+{
+	t_game	g;
+	long	cost;
+	int		i;
+
+	setup(&g);
+	levels[0] = g.scaler.level;
+	i = -1;
+	while (++i < FRAMES)
+	{
+		cost = full_us;
+		if (i >= SPIKE_AT && i < SPIKE_AT + spike_frames)
+			cost = spike_us;
+		update_render_scale(&g, cost * g.scaler.level * g.scaler.level
+			/ (RENDER_SCALE_DEN * RENDER_SCALE_DEN));
+		if (g.scaler.level < levels[0])
+			levels[0] = g.scaler.level;
+		assert(g.scaler.level >= RENDER_SCALE_MIN);
+	}
+	levels[1] = g.scaler.level;
+	cleanup_render_scale(&g);
+}
+
+static void	test_steady(void)
+{
+	int	levels[2];
+
+	run(RENDER_BUDGET_US * 64 / 100, 0, 0, levels);
+	assert(levels[0] == RENDER_SCALE_DEN && levels[1] == RENDER_SCALE_DEN);
+	printf("test_steady OK\n");
+}
+
+static void	test_spike(void)
+{
+	const long	spikes[] = {RENDER_BUDGET_US * 20, RENDER_BUDGET_US * 60,
+		RENDER_BUDGET_US * 200, RENDER_BUDGET_US * 2000};
+	int			levels[2];
+	size_t		i;
+
+	i = 0;
+	while (i < sizeof(spikes) / sizeof(spikes[0]))
+	{
+		run(RENDER_BUDGET_US * 64 / 100, spikes[i], 1, levels);
+		printf("spike of %8ld us: lowest level %d, last level %d\n",
+			spikes[i], levels[0], levels[1]);
+		assert(levels[0] == RENDER_SCALE_DEN - 1);
+		assert(levels[1] == RENDER_SCALE_DEN);
+		i++;
+	}
+	printf("test_spike OK\n");
+}
+
+static void	test_overload(void)
+{
+	int	levels[2];
+
+	run(RENDER_BUDGET_US * 64 / 100, RENDER_BUDGET_US * 2, 40, levels);
+	assert(levels[0] < RENDER_SCALE_DEN - 1);
+	assert(levels[1] == RENDER_SCALE_DEN);
+	run(RENDER_BUDGET_US * 10, 0, 0, levels);
+	assert(levels[0] == RENDER_SCALE_MIN && levels[1] == RENDER_SCALE_MIN);
+	printf("test_overload OK\n");
+}
+
+int	main(void)
+{
+	test_steady();
+	test_spike();
+	test_overload();
+	printf("All render scale tests passed!\n");
+	return (0);
+}
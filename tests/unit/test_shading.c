@@ -0,0 +1,200 @@
+/**
+ * @file test_shading.c
+ * @brief Unit tests for distance fog and its precomputed shade tables.
+ *
+ * Checks the per level channel tables built by build_shade_tables(),
+ * the level picked for a distance, that fogged wall slices (32-bit and
+ * palettised) match the unshaded slice passed through the column's
+ * table, and that rays stop at the fog distance on an open map.
+ *
+ * Runs headless: textures are plain pixel buffers, no MLX connection.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_shading.c
+ *   Run:   ./bin/test_shading
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FOG_DIST 8
+#define FRAME_W 2
+#define FRAME_H 256
+#define ROOM_SIZE 40
+
+/**
+ * @brief Fills a texture with 16 distinct colors
+ */
+static void	make_texture(t_texture *tex, unsigned int *pixels)
+{
+	int	i;
+
+	i = 0;
+	while (i < 64 * 64)
+	{
+		pixels[i] = 0x110000 * (i % 16) + 0x20 * (i / 64 % 4) + 0x8000;
+		i++;
+	}
+	memset(tex, 0, sizeof(*tex));
+	tex->addr = (char *)pixels;
+	tex->width = 64;
+	tex->height = 64;
+	tex->bpp = 32;
+	tex->line_len = 64 * 4;
+}
+
+static void	test_shade_tables(void)
+{
+	t_shade	shade;
+	int		level;
+	int		v;
+
+	memset(&shade, 0, sizeof(shade));
+	shade.fog_dist = FOG_DIST;
+	build_shade_tables(&shade);
+	v = 0;
+	while (v < 3 * 256)
+	{
+		assert(shade.lut[0][v] == v % 256);
+		assert(shade.lut[SHADE_LEVELS - 1][v] == ((FOG_COLOR >> (16 - 8
+						* (v / 256))) & 0xFF));
+		level = 1;
+		while (level < SHADE_LEVELS)
+		{
+			assert(shade.lut[level][v] <= shade.lut[level - 1][v]);
+			level++;
+		}
+		v++;
+	}
+	assert(shade_pixel(shade.lut[0], 0x12345678) == 0x12345678);
+	assert(shade_pixel(shade.lut[SHADE_LEVELS - 1], 0xFFFFFF) == FOG_COLOR);
+	printf("test_shade_tables OK\n");
+}
+
+static void	test_shade_level(void)
+{
+	t_shade	shade;
+
+	memset(&shade, 0, sizeof(shade));
+	assert(shade_level(&shade, 100.0) == 0);
+	assert(shade_lut(&shade, 100.0) == NULL);
+	shade.fog_dist = FOG_DIST;
+	build_shade_tables(&shade);
+	assert(shade_level(&shade, 0.0) == 0);
+	assert(shade_lut(&shade, 0.1) == NULL);
+	assert(shade_level(&shade, FOG_DIST / 2.0) == (SHADE_LEVELS - 1) / 2);
+	assert(shade_level(&shade, FOG_DIST) == SHADE_LEVELS - 1);
+	assert(shade_level(&shade, FOG_DIST * 10) == SHADE_LEVELS - 1);
+	assert(shade_lut(&shade, FOG_DIST) == shade.lut[SHADE_LEVELS - 1]);
+	printf("test_shade_level OK\n");
+}
+
+/**
+ * @brief Checks a fogged slice against the unshaded one, pixel by pixel
+ */
+static void	check_fogged_slice(t_game *g, int wall_dir, double dist)
+{
+	static unsigned int	plain[FRAME_W * FRAME_H];
+	const unsigned char	*lut;
+	t_draw_info			info;
+	double				fog_dist;
+	int					y;
+
+	info = (t_draw_info){.x = 0, .draw_start = 0, .draw_end = FRAME_H - 1,
+		.line_height = FRAME_H * 2, .wall_dir = wall_dir, .wall_x = 0.4};
+	fog_dist = g->shade.fog_dist;
+	g->shade.fog_dist = 0;
+	draw_textured_wall_slice(g, info);
+	memcpy(plain, g->frame.pixels, sizeof(plain));
+	g->shade.fog_dist = fog_dist;
+	info.wall_dist = dist;
+	draw_textured_wall_slice(g, info);
+	lut = shade_lut(&g->shade, dist);
+	y = 0;
+	while (y < FRAME_H)
+	{
+		if (lut)
+			assert(g->frame.pixels[y * FRAME_W]
+				== shade_pixel(lut, plain[y * FRAME_W]));
+		else
+			assert(g->frame.pixels[y * FRAME_W] == plain[y * FRAME_W]);
+		y++;
+	}
+}
+
+static void	test_fogged_walls(void)
+{
+	static unsigned int	pixels[64 * 64];
+	static unsigned int	frame[FRAME_W * FRAME_H];
+	t_game				g;
+
+	memset(&g, 0, sizeof(g));
+	g.frame = (t_frame){.pixels = frame, .width = FRAME_W,
+		.height = FRAME_H, .stride = FRAME_W};
+	make_texture(&g.textures[ID_NO], pixels);
+	make_texture(&g.textures[ID_SO], pixels);
+	g.textures[ID_SO].palettise = true;
+	g.shade.fog_dist = FOG_DIST;
+	build_shade_tables(&g.shade);
+	assert(build_texture_atlas(&g.atlas, g.textures, ID_FLOOR, &g.shade)
+		== EXIT_SUCCESS);
+	assert(g.textures[ID_SO].shaded_palettes);
+	assert(!g.textures[ID_NO].shaded_palettes);
+	check_fogged_slice(&g, ID_NO, 0.0);
+	check_fogged_slice(&g, ID_NO, 3.3);
+	check_fogged_slice(&g, ID_NO, FOG_DIST);
+	check_fogged_slice(&g, ID_SO, 0.0);
+	check_fogged_slice(&g, ID_SO, 5.7);
+	check_fogged_slice(&g, ID_SO, FOG_DIST);
+	assert(g.frame.pixels[0] == FOG_COLOR);
+	free_texture_atlas(&g.atlas);
+	printf("test_fogged_walls OK\n");
+}
+
+/**
+ * @brief Rays across an open room stop at the fog distance
+ */
+static void	test_fog_cutoff(void)
+{
+	static char		rows[ROOM_SIZE][ROOM_SIZE + 1];
+	char			*grid[ROOM_SIZE];
+	t_game			g;
+	t_ray_result	r;
+	int				i;
+
+	memset(&g, 0, sizeof(g));
+	i = 0;
+	while (i < ROOM_SIZE)
+	{
+		memset(rows[i], '0', ROOM_SIZE);
+		rows[i][0] = '1';
+		rows[i][ROOM_SIZE - 1] = '1';
+		if (i == 0 || i == ROOM_SIZE - 1)
+			memset(rows[i], '1', ROOM_SIZE);
+		grid[i] = rows[i];
+		i++;
+	}
+	g.map = (t_map){.grid = grid, .width = ROOM_SIZE, .height = ROOM_SIZE};
+	g.player.pos_x = 1.5;
+	g.player.pos_y = ROOM_SIZE / 2 + 0.5;
+	r = cast_ray(&g, 1.0, 0.0);
+	assert(fabs(r.wall_dist - (ROOM_SIZE - 2.5)) < 1e-9);
+	g.shade.fog_dist = FOG_DIST;
+	build_shade_tables(&g.shade);
+	r = cast_ray(&g, 1.0, 0.0);
+	assert(r.wall_dist == FOG_DIST);
+	r = cast_ray(&g, -1.0, 0.0);
+	assert(fabs(r.wall_dist - 0.5) < 1e-9);
+	printf("test_fog_cutoff OK\n");
+}
+
+int	main(void)
+{
+	test_shade_tables();
+	test_shade_level();
+	test_fogged_walls();
+	test_fog_cutoff();
+	printf("All shading tests passed!\n");
+	return (0);
+}
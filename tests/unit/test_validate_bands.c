@@ -0,0 +1,157 @@
+/**
+ * @file test_validate_bands.c
+ * @brief Tests the banded, multi-threaded map validation
+ *        (check_map_bands()).
+ *
+ * On a 300 x 1024 map, whatever the number of bands, checks that:
+ *   - a closed map is accepted
+ *   - an error next to a band edge is found from either side
+ *   - with several errors, the one reported is the first in row-major
+ *     order, as a plain single-threaded scan finds it
+ *   - the same holds on many maps with random errors
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_validate_bands.c
+ *   Run:   ./bin/test_validate_bands
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define W 300
+#define H 1024
+#define TRIALS 60
+
+static char	g_rows[H][W + 1];
+static char	*g_grid[H];
+
+static void	reset_map(t_map *map)
+{
+	int	y;
+
+	memset(map, 0, sizeof(*map));
+	y = -1;
+	while (++y < H)
+	{
+		memset(g_rows[y], '0', W);
+		if (y == 0 || y == H - 1)
+			memset(g_rows[y], '1', W);
+		g_rows[y][0] = '1';
+		g_rows[y][W - 1] = '1';
+		g_rows[y][W] = '\0';
+		g_grid[y] = g_rows[y];
+	}
+	map->grid = g_grid;
+	map->width = W;
+	map->height = H;
+}
+
+/**
+ * @brief Runs check_map_bands() and returns its message ("" if valid)
+ */
+static const char	*run_bands(t_map *map, int jobs)
+{
+	static t_error_log	log;
+	int					status;
+
+	memset(&log, 0, sizeof(log));
+	*error_log() = &log;
+	status = check_map_bands(map, jobs);
+	*error_log() = NULL;
+	assert((status == EXIT_SUCCESS) == (log.len == 0));
+	return (log.msg);
+}
+
+/**
+ * @brief Reference: message of the first bad cell in row-major order
+ */
+static const char	*first_error(t_map *map)
+{
+	static t_error_log	log;
+	int					i;
+
+	memset(&log, 0, sizeof(log));
+	*error_log() = &log;
+	i = 0;
+	while (i < W * H && check_map_cell(map, i / W, i % W) == EXIT_SUCCESS)
+		i++;
+	*error_log() = NULL;
+	return (log.msg);
+}
+
+/**
+ * @brief Checks every number of bands against the reference
+ */
+static void	check_all_jobs(t_map *map, const char *expected)
+{
+	const int	jobs[] = {1, 2, 3, 7, 8, 16, 64, 1000};
+	const char	*ref;
+	size_t		i;
+
+	ref = first_error(map);
+	assert(!expected || strcmp(ref, expected) == 0);
+	i = 0;
+	while (i < sizeof(jobs) / sizeof(jobs[0]))
+		assert(strcmp(run_bands(map, jobs[i++]), ref) == 0);
+}
+
+/**
+ * @brief Errors near band edges (H / 8 is one with 8 bands), then
+ *        earlier and earlier errors added to the same map
+ */
+static void	test_cases(void)
+{
+	t_map	map;
+
+	reset_map(&map);
+	check_all_jobs(&map, "");
+	g_rows[H / 8][5] = ' ';
+	check_all_jobs(&map, MAP_ZERO_INVALID);
+	reset_map(&map);
+	g_rows[H / 8 - 1][5] = ' ';
+	check_all_jobs(&map, MAP_ZERO_INVALID);
+	g_rows[0][5] = ' ';
+	check_all_jobs(&map, MAP_SPACE);
+	g_rows[0][3] = 'X';
+	check_all_jobs(&map, MAP_CHAR);
+	reset_map(&map);
+	g_rows[H / 2][W - 1] = '0';
+	g_rows[H - 3][7] = 'Z';
+	check_all_jobs(&map, MAP_ZERO_BORDER);
+	reset_map(&map);
+	g_rows[H - 1][W / 2] = ' ';
+	check_all_jobs(&map, MAP_ZERO_INVALID);
+	assert(map_band_count(&map) >= 1 && map_band_count(&map) <= MAP_BAND_MAX);
+	printf("test_cases OK\n");
+}
+
+static void	test_random(void)
+{
+	const char		cells[] = " X01";
+	t_map			map;
+	unsigned int	seed;
+	int				trial;
+	int				n;
+
+	seed = 7;
+	trial = 0;
+	while (trial++ < TRIALS)
+	{
+		reset_map(&map);
+		n = rand_r(&seed) % 5;
+		while (n-- > 0)
+			g_rows[rand_r(&seed) % H][rand_r(&seed) % W]
+				= cells[rand_r(&seed) % 4];
+		check_all_jobs(&map, NULL);
+	}
+	printf("test_random OK (%d maps)\n", TRIALS);
+}
+
+int	main(void)
+{
+	test_cases();
+	test_random();
+	printf("All validate bands tests passed!\n");
+	return (0);
+}
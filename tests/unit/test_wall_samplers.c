@@ -0,0 +1,147 @@
+/**
+ * @file test_wall_samplers.c
+ * @brief Unit tests for wall textures of arbitrary size.
+ *
+ * Builds textures of several sizes (power of two and not), checks
+ * which sampler set_wall_sampler() picks for them, then draws wall
+ * slices with draw_textured_wall_slice() and compares every pixel with
+ * the texel a plain floating point step would pick.
+ *
+ * Each texel stores its own coordinates (row * 4096 + column), so the
+ * drawn pixel tells exactly which texel was sampled.
+ *
+ * Usage:
+ *   Build: make build TEST=unit/test_wall_samplers.c
+ *   Run:   ./bin/test_wall_samplers
+ */
+#include "cub3d.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FRAME_W 3
+#define FRAME_H 1024
+#define SENTINEL 0xDEADBEEF
+#define COORD_BASE 4096
+
+typedef struct s_size_test
+{
+	int		width;
+	int		height;
+	bool	expect_pow2;
+}	t_size_test;
+
+/**
+ * @brief Allocates a texture whose texels encode their coordinates
+ */
+static void	make_coord_texture(t_game *g, int width, int height)
+{
+	t_texture		*tex;
+	unsigned int	*pixels;
+	int				i;
+
+	tex = &g->textures[ID_NO];
+	pixels = malloc(sizeof(unsigned int) * width * height);
+	assert(pixels);
+	i = 0;
+	while (i < width * height)
+	{
+		pixels[i] = (i / width) * COORD_BASE + i % width;
+		i++;
+	}
+	memset(tex, 0, sizeof(*tex));
+	tex->addr = (char *)pixels;
+	tex->width = width;
+	tex->height = height;
+	tex->bpp = 32;
+	tex->line_len = width * 4;
+	assert(build_texture_atlas(&g->atlas, tex, 1, NULL) == EXIT_SUCCESS);
+	free(pixels);
+	tex->addr = NULL;
+}
+
+/**
+ * @brief Draws one wall slice and checks every pixel of the column
+ */
+static void	check_slice(t_game *g, int line_height, double wall_x)
+{
+	t_draw_info		info;
+	int				y;
+	int				row;
+	double			exact;
+	unsigned int	px;
+
+	info.x = 1;
+	info.line_height = line_height;
+	info.draw_start = (FRAME_H - line_height) / 2;
+	info.draw_end = info.draw_start + line_height - 1;
+	if (info.draw_start < 0)
+		info.draw_start = 0;
+	if (info.draw_end >= FRAME_H)
+		info.draw_end = FRAME_H - 1;
+	info.wall_dir = ID_NO;
+	info.wall_x = wall_x;
+	y = 0;
+	while (y < FRAME_H * FRAME_W)
+		g->frame.pixels[y++] = SENTINEL;
+	draw_textured_wall_slice(g, info);
+	y = 0;
+	while (y < FRAME_H)
+	{
+		px = g->frame.pixels[y * FRAME_W + info.x];
+		assert(g->frame.pixels[y * FRAME_W] == SENTINEL);
+		if (y < info.draw_start || y > info.draw_end)
+		{
+			assert(px == SENTINEL);
+			y++;
+			continue ;
+		}
+		row = px / COORD_BASE;
+		exact = (y - (FRAME_H - line_height) / 2)
+			* (double)g->textures[ID_NO].height / line_height;
+		assert(row >= 0 && row < g->textures[ID_NO].height);
+		assert(row == (int)exact || row == (int)exact - 1);
+		assert((int)(px % COORD_BASE)
+			== calculate_tex_x(wall_x, g->textures[ID_NO].width));
+		y++;
+	}
+}
+
+static void	test_size(t_game *g, t_size_test test)
+{
+	t_texture	*tex;
+
+	make_coord_texture(g, test.width, test.height);
+	tex = &g->textures[ID_NO];
+	assert((tex->mips[0].row_shift >= 0 && (test.height & (test.height - 1))
+			== 0) == test.expect_pow2);
+	check_slice(g, test.height / 2 + 1, 0.0);
+	check_slice(g, test.height, 0.37);
+	check_slice(g, test.height * 3 + 1, 0.999);
+	check_slice(g, FRAME_H, 0.5);
+	free_texture_atlas(&g->atlas);
+	printf("test_size %dx%d (%s sampler) OK\n", test.width, test.height,
+		test.expect_pow2 ? "pow2" : "generic");
+}
+
+int	main(void)
+{
+	static unsigned int	pixels[FRAME_W * FRAME_H];
+	const t_size_test	tests[] = {
+	{64, 64, true}, {128, 128, true}, {512, 512, true}, {256, 64, true},
+	{96, 96, false}, {100, 50, false}, {64, 100, false}, {3, 7, false},
+	};
+	t_game				g;
+	size_t				i;
+
+	memset(&g, 0, sizeof(g));
+	g.frame.pixels = pixels;
+	g.frame.width = FRAME_W;
+	g.frame.height = FRAME_H;
+	g.frame.stride = FRAME_W;
+	i = 0;
+	while (i < sizeof(tests) / sizeof(tests[0]))
+		test_size(&g, tests[i++]);
+	printf("All wall sampler tests passed!\n");
+	return (0);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapgen.h"
+
+/**
+ * @brief Procedural .cub generator for scale and stress testing
+ *
+ * Writes a closed, valid map of the chosen layout and size, with the
+ * player and texture set given on the command line. The output only
+ * depends on the arguments, so a seed always gives the same map:
+ *
+ *   ./mapgen maze 1001 1001 --seed 7 -o maps/gen/maze_1001.cub
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+int	main(int argc, char **argv)
+{
+	t_mapgen		mg;
+	const t_layout	*layout;
+	int				status;
+
+	if (parse_mapgen_args(argc, argv, &mg, &layout) != EXIT_SUCCESS)
+	{
+		ft_putendl_fd(MG_USAGE_LAYOUTS, STDERR_FILENO);
+		return (EXIT_FAILURE);
+	}
+	mg.cells = malloc((size_t)mg.width * mg.height);
+	if (!mg.cells)
+		return (print_errors(MG_ALLOC, NULL, NULL), EXIT_FAILURE);
+	layout->fill(&mg);
+	status = place_player(&mg);
+	if (status == EXIT_SUCCESS)
+		status = write_cub_file(&mg);
+	free(mg.cells);
+	return (status);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapgen_args.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 09:16:11 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapgen.h"
+
+/**
+ * @brief Parses a map side length
+ *
+ * Sides stop at the game's own cap, so every generated map loads.
+ *
+ * @param arg Argument to parse
+ * @param max Longest side: MAX_MAP_W or MAX_MAP_H
+ * @param side Receives the side, MG_MIN_SIDE to max
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	parse_side(const char *arg, int max, int *side)
+{
+	if (!ft_safe_atoi(arg, side) || *side < MG_MIN_SIDE || *side > max)
+	{
+		print_errors(MG_SIZE, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Parses a player pose written X,Y,D
+ *
+ * The cell itself is checked once the grid is generated.
+ *
+ * @param arg Argument to parse
+ * @param mg Receives the pose
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	parse_pose(const char *arg, t_mapgen *mg)
+{
+	char	**parts;
+	int		ok;
+
+	parts = ft_split(arg, ',');
+	ok = parts && parts[0] && parts[1] && parts[2] && !parts[3]
+		&& ft_safe_atoi(parts[0], &mg->pose_x) && mg->pose_x >= 0
+		&& ft_safe_atoi(parts[1], &mg->pose_y) && mg->pose_y >= 0
+		&& ft_strlen(parts[2]) == 1 && ft_strchr(PLAYER, parts[2][0]);
+	if (ok)
+		mg->pose_dir = parts[2][0];
+	free_strings_array(parts);
+	if (!ok)
+	{
+		print_errors(MG_POSE, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Checks if a texture set exists under MG_TEXTURE_DIR
+ *
+ * @param name Texture set name
+ * @return true for one of the sets shipped in assets/textures
+ */
+static bool	is_texture_set(const char *name)
+{
+	const char	*sets[] = {"bricks", "clouds", "colors", "dino_weird", "sky",
+		"twin_peaks", NULL};
+	int			i;
+
+	i = 0;
+	while (sets[i] && ft_strcmp(sets[i], name))
+		i++;
+	return (sets[i] != NULL);
+}
+
+/**
+ * @brief Parses one option and its value
+ *
+ * @param opt Option name
+ * @param value Option value, NULL if missing
+ * @param mg Generator settings to fill
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+static int	parse_option(const char *opt, const char *value, t_mapgen *mg)
+{
+	int	seed;
+
+	if (!value)
+		return (print_errors(MG_USAGE, MG_USAGE_OPTIONS, NULL), EXIT_FAILURE);
+	if (!ft_strcmp(opt, "--seed"))
+	{
+		if (!ft_safe_atoi(value, &seed) || seed < 0)
+			return (print_errors(MG_SEED, NULL, NULL), EXIT_FAILURE);
+		mg->seed = (unsigned)seed * 2654435761u | 1;
+	}
+	else if (!ft_strcmp(opt, "--pose"))
+		return (parse_pose(value, mg));
+	else if (!ft_strcmp(opt, "--textures") && is_texture_set(value))
+		mg->textures = value;
+	else if (!ft_strcmp(opt, "--textures"))
+		return (print_errors(MG_TEXTURES, (char *)value, NULL), EXIT_FAILURE);
+	else if (!ft_strcmp(opt, "-o"))
+		mg->out_path = value;
+	else
+		return (print_errors(MG_USAGE, MG_USAGE_OPTIONS, NULL), EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Parses the layout, the map size and the options
+ *
+ * Defaults: seed MG_DEFAULT_SEED, MG_DEFAULT_TEXTURES, player picked by
+ * place_player(), output to stdout.
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param mg Generator settings to fill
+ * @param layout Receives the chosen layout
+ * @return EXIT_SUCCESS, or EXIT_FAILURE with an error message
+ */
+int	parse_mapgen_args(int argc, char **argv, t_mapgen *mg,
+		const t_layout **layout)
+{
+	int	i;
+
+	*mg = (t_mapgen){.seed = MG_DEFAULT_SEED * 2654435761u | 1,
+		.pose_x = -1, .pose_dir = 'N', .textures = MG_DEFAULT_TEXTURES};
+	if (argc < 4)
+		return (print_errors(MG_USAGE, MG_USAGE_OPTIONS, NULL), EXIT_FAILURE);
+	*layout = get_layouts();
+	while ((*layout)->name && ft_strcmp((*layout)->name, argv[1]))
+		(*layout)++;
+	if (!(*layout)->name)
+		return (print_errors(MG_LAYOUT, argv[1], NULL), EXIT_FAILURE);
+	if (parse_side(argv[2], MAX_MAP_W, &mg->width)
+		|| parse_side(argv[3], MAX_MAP_H, &mg->height))
+		return (EXIT_FAILURE);
+	i = 4;
+	while (i < argc)
+	{
+		if (parse_option(argv[i], argv[i + 1], mg))
+			return (EXIT_FAILURE);
+		i += 2;
+	}
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapgen_layouts.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapgen.h"
+
+/**
+ * @brief Walls in the map border and fills everything inside it
+ *
+ * @param mg Generator state (grid allocated)
+ * @param inside Character of the inner cells
+ */
+void	fill_arena(t_mapgen *mg, char inside)
+{
+	int	y;
+
+	y = 0;
+	while (y < mg->height)
+	{
+		ft_memset(mg->cells + (size_t)y * mg->width, inside, mg->width);
+		mg->cells[(size_t)y * mg->width] = '1';
+		mg->cells[(size_t)y * mg->width + mg->width - 1] = '1';
+		y++;
+	}
+	ft_memset(mg->cells, '1', mg->width);
+	ft_memset(mg->cells + (size_t)(mg->height - 1) * mg->width, '1',
+		mg->width);
+}
+
+/**
+ * @brief Open arena: one room, walls only on the border
+ *
+ * @param mg Generator state
+ */
+static void	gen_arena(t_mapgen *mg)
+{
+	fill_arena(mg, '0');
+}
+
+/**
+ * @brief Pillar field: an arena where about half of the cells of a
+ *        MG_PILLAR_STEP lattice hold a one cell pillar
+ *
+ * Pillars never touch each other, so every open cell stays reachable.
+ *
+ * @param mg Generator state
+ */
+static void	gen_pillars(t_mapgen *mg)
+{
+	int	x;
+	int	y;
+
+	fill_arena(mg, '0');
+	y = MG_PILLAR_STEP - 1;
+	while (y < mg->height - 1)
+	{
+		x = MG_PILLAR_STEP - 1;
+		while (x < mg->width - 1)
+		{
+			if (mapgen_rand(mg) & 1)
+				mg->cells[(size_t)y * mg->width + x] = '1';
+			x += MG_PILLAR_STEP;
+		}
+		y += MG_PILLAR_STEP;
+	}
+}
+
+/**
+ * @brief Long corridors: one cell high corridors spanning the map
+ *        width, each linked to the next one by a single door
+ *
+ * Door columns are random, so going from the top corridor to the bottom
+ * one walks most of the map.
+ *
+ * @param mg Generator state
+ */
+static void	gen_corridors(t_mapgen *mg)
+{
+	int	y;
+
+	fill_arena(mg, '0');
+	y = 2;
+	while (y < mg->height - 1)
+	{
+		ft_memset(mg->cells + (size_t)y * mg->width, '1', mg->width);
+		mg->cells[(size_t)y * mg->width + 1
+			+ mapgen_rand(mg) % (mg->width - 2)] = '0';
+		y += 2;
+	}
+}
+
+/**
+ * @brief Returns the table of layouts, ended by a NULL name
+ *
+ * @return Pointer to the static layout table
+ */
+const t_layout	*get_layouts(void)
+{
+	static const t_layout	layouts[] = {
+	{"arena", gen_arena},
+	{"pillars", gen_pillars},
+	{"corridors", gen_corridors},
+	{"maze", gen_maze},
+	{"spiral", gen_spiral},
+	{NULL, NULL}
+	};
+
+	return (layouts);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapgen_maze.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapgen.h"
+
+/**
+ * @brief Ends a sidewinder run by opening its wall to the row above
+ *
+ * @param mg Generator state
+ * @param y Grid row of the run
+ * @param start First maze cell of the run
+ * @param end Last maze cell of the run
+ */
+static void	close_run(t_mapgen *mg, int y, int start, int end)
+{
+	int	x;
+
+	x = 2 * (start + (int)(mapgen_rand(mg) % (end - start + 1))) + 1;
+	mg->cells[(size_t)(y - 1) * mg->width + x] = '0';
+}
+
+/**
+ * @brief Perfect maze of one cell wide passages (sidewinder algorithm)
+ *
+ * Maze cells sit on odd grid coordinates. The top row is one corridor.
+ * Every other row is cut into runs of random length, and each run is
+ * linked to the row above through one random cell, so every cell is
+ * reachable through exactly one path. Works row by row, with no stack,
+ * so it scales to any map size. With an even side, the last column or
+ * row stays solid wall.
+ *
+ * @param mg Generator state
+ */
+void	gen_maze(t_mapgen *mg)
+{
+	int	cell_x;
+	int	y;
+	int	start;
+
+	fill_arena(mg, '1');
+	y = 1;
+	while (y < mg->height - 1)
+	{
+		start = 0;
+		cell_x = 0;
+		while (2 * cell_x + 1 < mg->width - 1)
+		{
+			mg->cells[(size_t)y * mg->width + 2 * cell_x + 1] = '0';
+			if (2 * cell_x + 3 < mg->width - 1
+				&& (y == 1 || mapgen_rand(mg) & 1))
+				mg->cells[(size_t)y * mg->width + 2 * cell_x + 2] = '0';
+			else if (y > 1)
+			{
+				close_run(mg, y, start, cell_x);
+				start = cell_x + 1;
+			}
+			cell_x++;
+		}
+		y += 2;
+	}
+}
+
+/**
+ * @brief Draws wall ring k of the spiral, with its single gap
+ *
+ * Ring k runs 2k cells inside the border. Gaps alternate between the
+ * top left and the bottom right of the rings, so reaching the center
+ * walks half way around every ring.
+ *
+ * @param mg Generator state
+ * @param k Ring index, from 1
+ */
+static void	draw_ring(t_mapgen *mg, int k)
+{
+	int	left;
+	int	right;
+	int	y;
+
+	left = 2 * k;
+	right = mg->width - 1 - 2 * k;
+	y = 2 * k;
+	ft_memset(mg->cells + (size_t)y * mg->width + left, '1', right - left + 1);
+	while (++y < mg->height - 1 - 2 * k)
+	{
+		mg->cells[(size_t)y * mg->width + left] = '1';
+		mg->cells[(size_t)y * mg->width + right] = '1';
+	}
+	ft_memset(mg->cells + (size_t)y * mg->width + left, '1', right - left + 1);
+	if (k % 2)
+		mg->cells[(size_t)(2 * k) * mg->width + left + 1] = '0';
+	else
+		mg->cells[(size_t)y * mg->width + right - 1] = '0';
+}
+
+/**
+ * @brief Worst case nested rings, like maps/test_maps/spiral_map.cub
+ *
+ * Concentric wall rings two cells apart, each with one gap, around a
+ * small room in the middle: the longest walk for a flood fill and many
+ * close walls for the DDA.
+ *
+ * @param mg Generator state
+ */
+void	gen_spiral(t_mapgen *mg)
+{
+	int	k;
+
+	fill_arena(mg, '0');
+	k = 1;
+	while (mg->width - 4 * k >= 3 && mg->height - 4 * k >= 3)
+		draw_ring(mg, k++);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapgen_output.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:59:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapgen.h"
+
+/**
+ * @brief Next number of the generator's xorshift32 sequence
+ *
+ * The whole map only depends on the seed, so the same command always
+ * writes the same file.
+ *
+ * @param mg Generator state (seed never 0)
+ * @return Pseudo random 32-bit number
+ */
+unsigned int	mapgen_rand(t_mapgen *mg)
+{
+	mg->seed ^= mg->seed << 13;
+	mg->seed ^= mg->seed >> 17;
+	mg->seed ^= mg->seed << 5;
+	return (mg->seed);
+}
+
+/**
+ * @brief Puts the player on the grid
+ *
+ * Without --pose, the player stands on the first open cell from the
+ * middle of the map, in reading order, facing north.
+ *
+ * @param mg Generator state (grid filled)
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if the cell is not open
+ */
+int	place_player(t_mapgen *mg)
+{
+	size_t	cell;
+	size_t	count;
+	size_t	i;
+
+	count = (size_t)mg->width * mg->height;
+	cell = (size_t)mg->pose_y * mg->width + mg->pose_x;
+	if (mg->pose_x < 0)
+	{
+		i = 0;
+		cell = count / 2;
+		while (i++ < count && mg->cells[cell] != '0')
+			cell = (cell + 1) % count;
+	}
+	if (mg->pose_y >= mg->height || mg->pose_x >= mg->width
+		|| mg->cells[cell] != '0')
+	{
+		print_errors(MG_POSE_WALL, NULL, NULL);
+		return (EXIT_FAILURE);
+	}
+	mg->cells[cell] = mg->pose_dir;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Writes the texture and color header of the .cub file
+ *
+ * @param mg Generator state
+ * @param fd Output file
+ */
+static void	write_header(t_mapgen *mg, int fd)
+{
+	const char	*sides[] = {"NO", "SO", "WE", "EA", NULL};
+	int			i;
+
+	i = 0;
+	while (sides[i])
+	{
+		ft_putstr_fd((char *)sides[i], fd);
+		ft_putstr_fd(" " MG_TEXTURE_DIR, fd);
+		ft_putstr_fd((char *)mg->textures, fd);
+		ft_putchar_fd('/', fd);
+		ft_putstr_fd((char *)sides[i++], fd);
+		ft_putstr_fd(".xpm\n", fd);
+	}
+	ft_putstr_fd("\n" MG_FLOOR MG_CEILING "\n", fd);
+}
+
+/**
+ * @brief Writes the grid rows, each with one write, newline included
+ *
+ * @param mg Generator state
+ * @param fd Output file
+ * @return Number of rows written, mg->height on success
+ */
+static int	write_rows(t_mapgen *mg, int fd)
+{
+	char	*row;
+	int		y;
+
+	row = malloc(mg->width + 1);
+	if (!row)
+		return (0);
+	row[mg->width] = '\n';
+	y = 0;
+	while (y < mg->height)
+	{
+		ft_memcpy(row, mg->cells + (size_t)y * mg->width, mg->width);
+		if (write(fd, row, mg->width + 1) != mg->width + 1)
+			break ;
+		y++;
+	}
+	free(row);
+	return (y);
+}
+
+/**
+ * @brief Writes the map as a .cub file, or to stdout without -o
+ *
+ * @param mg Generator state (grid filled, player placed)
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if the file cannot be written
+ */
+int	write_cub_file(t_mapgen *mg)
+{
+	int	fd;
+	int	rows;
+
+	fd = STDOUT_FILENO;
+	if (mg->out_path)
+		fd = open(mg->out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	rows = 0;
+	if (fd >= 0)
+	{
+		write_header(mg, fd);
+		rows = write_rows(mg, fd);
+	}
+	if (mg->out_path && fd >= 0)
+		close(fd);
+	if (rows < mg->height)
+	{
+		print_errors(MG_OUTPUT, (char *)mg->out_path, NULL);
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}